@@ -0,0 +1,106 @@
+/**
+ * @file bench_aligned.cpp
+ * @brief Vector loads from cache-line aligned and misaligned buffers
+ *
+ * Sums 32-bit integers with 16-byte vector loads (SSE2 or NEON, scalar
+ * elsewhere) starting at a cache-line boundary and at an offset of 4 bytes.
+ * With the offset, every fourth load is split across two cache lines. The
+ * small buffer stays in L1, where split loads cost the most; the large one
+ * measures the effect when memory bandwidth dominates.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "trlc/platform/allocator.hpp"
+#include "trlc/platform/macros.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+using namespace trlc::platform;
+using trlc::platform::bench::doNotOptimize;
+using trlc::platform::bench::measureNanosPerOp;
+using trlc::platform::bench::reportThroughput;
+
+namespace {
+
+/// Sum of @p count values; @p count must be a multiple of 16
+TRLC_NEVER_INLINE uint32_t sum(const uint32_t* values, size_t count) {
+#if defined(__SSE2__) || defined(_M_X64)
+    // Four independent accumulators keep the loop bound by loads
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    __m128i acc2 = _mm_setzero_si128();
+    __m128i acc3 = _mm_setzero_si128();
+    for (size_t i = 0; i < count; i += 16) {
+        const auto* block = reinterpret_cast<const __m128i*>(values + i);
+        acc0 = _mm_add_epi32(acc0, _mm_loadu_si128(block));
+        acc1 = _mm_add_epi32(acc1, _mm_loadu_si128(block + 1));
+        acc2 = _mm_add_epi32(acc2, _mm_loadu_si128(block + 2));
+        acc3 = _mm_add_epi32(acc3, _mm_loadu_si128(block + 3));
+    }
+    const __m128i acc = _mm_add_epi32(_mm_add_epi32(acc0, acc1), _mm_add_epi32(acc2, acc3));
+    alignas(16) uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__ARM_NEON)
+    uint32x4_t acc0 = vdupq_n_u32(0);
+    uint32x4_t acc1 = vdupq_n_u32(0);
+    uint32x4_t acc2 = vdupq_n_u32(0);
+    uint32x4_t acc3 = vdupq_n_u32(0);
+    for (size_t i = 0; i < count; i += 16) {
+        acc0 = vaddq_u32(acc0, vld1q_u32(values + i));
+        acc1 = vaddq_u32(acc1, vld1q_u32(values + i + 4));
+        acc2 = vaddq_u32(acc2, vld1q_u32(values + i + 8));
+        acc3 = vaddq_u32(acc3, vld1q_u32(values + i + 12));
+    }
+    return vaddvq_u32(vaddq_u32(vaddq_u32(acc0, acc1), vaddq_u32(acc2, acc3)));
+#else
+    uint32_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += values[i];
+    }
+    return total;
+#endif
+}
+
+void run(const char* label, size_t count, size_t passes) {
+    // Spare elements so the misaligned view has the same length
+    std::vector<uint32_t, AlignedAllocator<uint32_t>> buffer(count + 16, 1);
+    const uint32_t* aligned = buffer.data();
+    const uint32_t* misaligned = buffer.data() + 1;
+
+    std::printf("%s (%zu KiB):\n", label, count * sizeof(uint32_t) / 1024);
+
+    const double bytes = static_cast<double>(count * sizeof(uint32_t));
+    const double aligned_ns = measureNanosPerOp(passes, [&] {
+        for (size_t pass = 0; pass < passes; ++pass) {
+            doNotOptimize(sum(aligned, count));
+        }
+    });
+    reportThroughput("Cache-line aligned", bytes, aligned_ns);
+
+    const double misaligned_ns = measureNanosPerOp(passes, [&] {
+        for (size_t pass = 0; pass < passes; ++pass) {
+            doNotOptimize(sum(misaligned, count));
+        }
+    });
+    reportThroughput("Offset by 4 bytes", bytes, misaligned_ns);
+}
+
+}  // namespace
+
+int main() {
+    std::printf("=== Aligned vs misaligned vector loads (alignment %zu) ===\n",
+                AlignedAllocator<uint32_t>::alignment);
+
+    run("L1-resident buffer", 4 * 1024, 20000);
+    run("Memory-resident buffer", 16 * 1024 * 1024, 5);
+    return 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file bench_arena.cpp
+ * @brief Request-scoped allocation with an Arena versus new and malloc
+ *
+ * Each simulated request allocates a batch of small blocks of mixed size,
+ * writes to them and then releases all of them. The general purpose
+ * allocators free every block individually; the arena is reset once per
+ * request.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "trlc/platform/arena.hpp"
+
+using namespace trlc::platform;
+using trlc::platform::bench::doNotOptimize;
+using trlc::platform::bench::measureNanosPerOp;
+using trlc::platform::bench::reportNanos;
+
+namespace {
+
+constexpr size_t BLOCKS_PER_REQUEST = 256;
+constexpr size_t REQUESTS = 2000;
+constexpr size_t ALLOCATIONS = BLOCKS_PER_REQUEST * REQUESTS;
+
+/// Block sizes between 16 and 256 bytes in a fixed pseudo-random order
+std::vector<size_t> makeSizes() {
+    std::vector<size_t> sizes(BLOCKS_PER_REQUEST);
+    uint32_t state = 12345;
+    for (size_t& size : sizes) {
+        state = state * 1664525u + 1013904223u;
+        size = 16 + (state >> 24);
+    }
+    return sizes;
+}
+
+const std::vector<size_t> g_sizes = makeSizes();
+
+TRLC_NEVER_INLINE void touch(void* memory) {
+    *static_cast<unsigned char*>(memory) = 1;
+}
+
+double benchNewDelete() {
+    std::vector<void*> blocks(BLOCKS_PER_REQUEST);
+    return measureNanosPerOp(ALLOCATIONS, [&] {
+        for (size_t request = 0; request < REQUESTS; ++request) {
+            for (size_t i = 0; i < BLOCKS_PER_REQUEST; ++i) {
+                blocks[i] = ::operator new(g_sizes[i]);
+                touch(blocks[i]);
+            }
+            for (void* block : blocks) {
+                ::operator delete(block);
+            }
+        }
+    });
+}
+
+double benchMalloc() {
+    std::vector<void*> blocks(BLOCKS_PER_REQUEST);
+    return measureNanosPerOp(ALLOCATIONS, [&] {
+        for (size_t request = 0; request < REQUESTS; ++request) {
+            for (size_t i = 0; i < BLOCKS_PER_REQUEST; ++i) {
+                blocks[i] = std::malloc(g_sizes[i]);
+                touch(blocks[i]);
+            }
+            for (void* block : blocks) {
+                std::free(block);
+            }
+        }
+    });
+}
+
+template <typename ArenaType>
+double benchArena(ArenaType& arena) {
+    return measureNanosPerOp(ALLOCATIONS, [&] {
+        for (size_t request = 0; request < REQUESTS; ++request) {
+            for (size_t i = 0; i < BLOCKS_PER_REQUEST; ++i) {
+                touch(arena.allocate(g_sizes[i]));
+            }
+            arena.reset();
+        }
+        doNotOptimize(arena.capacity());
+    });
+}
+
+#if defined(__cpp_lib_memory_resource)
+double benchPmrList() {
+    Arena arena;
+    ArenaResource resource(arena);
+    return measureNanosPerOp(ALLOCATIONS, [&] {
+        for (size_t request = 0; request < REQUESTS; ++request) {
+            std::pmr::list<uint32_t> values(&resource);
+            for (uint32_t i = 0; i < BLOCKS_PER_REQUEST; ++i) {
+                values.push_back(i);
+            }
+            doNotOptimize(values.back());
+            arena.reset();
+        }
+    });
+}
+
+double benchStdList() {
+    return measureNanosPerOp(ALLOCATIONS, [&] {
+        for (size_t request = 0; request < REQUESTS; ++request) {
+            std::list<uint32_t> values;
+            for (uint32_t i = 0; i < BLOCKS_PER_REQUEST; ++i) {
+                values.push_back(i);
+            }
+            doNotOptimize(values.back());
+        }
+    });
+}
+#endif
+
+}  // namespace
+
+int main() {
+    std::printf("=== %zu blocks of 16-271 bytes per request ===\n", BLOCKS_PER_REQUEST);
+    reportNanos("operator new / delete", benchNewDelete());
+    reportNanos("malloc / free", benchMalloc());
+
+    Arena arena;
+    reportNanos("Arena (page chunks, reset per request)", benchArena(arena));
+
+    InlineArena<64 * 1024> inline_arena;
+    reportNanos("InlineArena<64 KiB>", benchArena(inline_arena));
+
+#if defined(__cpp_lib_memory_resource)
+    std::printf("\n=== Building a %zu node list per request ===\n", BLOCKS_PER_REQUEST);
+    reportNanos("std::list", benchStdList());
+    reportNanos("std::pmr::list on ArenaResource", benchPmrList());
+#endif
+    return 0;
+}
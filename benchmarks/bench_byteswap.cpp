@@ -0,0 +1,149 @@
+/**
+ * @file bench_byteswap.cpp
+ * @brief Throughput of bulk byte swapping per kernel and element width
+ *
+ * Converts a buffer that fits in L1 and one that streams from memory with
+ * every kernel the CPU supports, and with a loop calling byteSwap() per
+ * element as callers did before the bulk functions existed. A second part
+ * decodes and sums a column with convertByteOrder(), once stored in native
+ * order and once in the opposite order.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "trlc/platform/byteswap.hpp"
+
+using namespace trlc::platform;
+using trlc::platform::bench::doNotOptimize;
+using trlc::platform::bench::measureNanosPerOp;
+using trlc::platform::bench::reportThroughput;
+
+namespace {
+
+template <typename Word>
+TRLC_NEVER_INLINE void swapEach(const Word* source, Word* destination, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        destination[i] = byteSwap(source[i]);
+    }
+}
+
+template <typename Word>
+void benchWidth(size_t bytes) {
+    const size_t count = bytes / sizeof(Word);
+    std::vector<Word> source(count);
+    std::vector<Word> destination(count);
+    for (size_t i = 0; i < count; ++i) {
+        source[i] = static_cast<Word>(i * 0x9E3779B97F4A7C15ull);
+    }
+    const size_t passes = std::max<size_t>(1, (size_t(64) << 20) / bytes);
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "%zu-bit byteSwap() loop", sizeof(Word) * 8);
+    reportThroughput(label, static_cast<double>(bytes), measureNanosPerOp(passes, [&] {
+                         for (size_t pass = 0; pass < passes; ++pass) {
+                             swapEach(source.data(), destination.data(), count);
+                             doNotOptimize(destination.front());
+                         }
+                     }));
+
+    const uint64_t cpu = detail::cpuFeatureBits();
+    const uint64_t tiers[] = {
+        0,
+        cpu & runtimeFeatureMask({RuntimeFeature::ssse3}),
+        cpu & runtimeFeatureMask({RuntimeFeature::ssse3, RuntimeFeature::avx2}),
+        cpu & runtimeFeatureMask({RuntimeFeature::neon}),
+        cpu};
+    std::set<std::string> seen;
+    for (uint64_t features : tiers) {
+        const auto kernel = detail::selectByteSwapKernel<sizeof(Word)>(features);
+        if (!seen.insert(kernel.name()).second) {
+            continue;
+        }
+        std::snprintf(label, sizeof(label), "%zu-bit %s", sizeof(Word) * 8, kernel.name());
+        reportThroughput(label, static_cast<double>(bytes), measureNanosPerOp(passes, [&] {
+                             for (size_t pass = 0; pass < passes; ++pass) {
+                                 kernel(source.data(), destination.data(), count);
+                                 doNotOptimize(destination.front());
+                             }
+                         }));
+    }
+}
+
+void benchSize(const char* title, size_t bytes) {
+    std::printf("\n=== %s: %zu KiB copy ===\n", title, bytes >> 10);
+    benchWidth<uint16_t>(bytes);
+    benchWidth<uint32_t>(bytes);
+    benchWidth<uint64_t>(bytes);
+#if TRLC_HAS_INT128
+    benchWidth<detail::Uint128>(bytes);
+#endif
+}
+
+/// Consume decoded values the way a deserializer would
+TRLC_NEVER_INLINE uint64_t sumValues(const uint32_t* values, size_t count) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += values[i];
+    }
+    return sum;
+}
+
+TRLC_NEVER_INLINE uint64_t sumConverted(const uint32_t* values,
+                                        size_t count,
+                                        ByteOrder from,
+                                        ByteOrder to) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += convertByteOrder(values[i], from, to);
+    }
+    return sum;
+}
+
+void benchDeserialize(ByteOrder stored, const char* title) {
+    constexpr size_t bytes = size_t(4) << 20;
+    constexpr size_t count = bytes / sizeof(uint32_t);
+    constexpr size_t passes = 16;
+    std::vector<uint32_t> column(count, 0x01020304);
+    std::vector<uint32_t> decoded(count);
+    const ByteOrder native = getByteOrder();
+
+    std::printf("\n=== Decoding and summing a %zu MiB column stored %s ===\n", bytes >> 20, title);
+    reportThroughput("per-element convertByteOrder()", bytes, measureNanosPerOp(passes, [&] {
+                         for (size_t pass = 0; pass < passes; ++pass) {
+                             doNotOptimize(sumConverted(column.data(), count, stored, native));
+                         }
+                     }));
+    reportThroughput("bulk convertByteOrder() copy", bytes, measureNanosPerOp(passes, [&] {
+                         for (size_t pass = 0; pass < passes; ++pass) {
+                             convertByteOrder(column.data(), decoded.data(), count, stored, native);
+                             doNotOptimize(sumValues(decoded.data(), count));
+                         }
+                     }));
+#if defined(__cpp_lib_span)
+    reportThroughput("bulk convertByteOrder() view", bytes, measureNanosPerOp(passes, [&] {
+                         for (size_t pass = 0; pass < passes; ++pass) {
+                             const std::span<const uint32_t> view =
+                                 convertByteOrder<uint32_t>(column, decoded, stored, native);
+                             doNotOptimize(sumValues(view.data(), view.size()));
+                         }
+                     }));
+#endif
+}
+
+}  // namespace
+
+int main() {
+    std::printf("=== Bulk byte swap (selected: %s) ===\n", byteSwapImplementation());
+    benchSize("L1 resident", size_t(16) << 10);
+    benchSize("Memory bound", size_t(64) << 20);
+
+    benchDeserialize(getByteOrder(), "in native order");
+    benchDeserialize(getOppositeByteOrder(getByteOrder()), "in foreign order");
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file bench_dispatch.cpp
+ * @brief Call overhead of Dispatch compared with a direct call
+ *
+ * The kernels are kept out of line so that every variant pays for a real
+ * call; the difference between the rows is the cost of the dispatch itself.
+ * TRLC_DISPATCH_FUNCTION is measured with whichever backend the build selected.
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmark_utils.hpp"
+#include "trlc/platform/dispatch.hpp"
+#include "trlc/platform/macros.hpp"
+
+using namespace trlc::platform;
+using trlc::platform::bench::doNotOptimize;
+using trlc::platform::bench::measureNanosPerOp;
+using trlc::platform::bench::reportNanos;
+
+namespace {
+
+TRLC_NEVER_INLINE uint64_t mixScalar(uint64_t value) {
+    return value * 0x9E3779B97F4A7C15ull + 1;
+}
+
+TRLC_NEVER_INLINE uint64_t mixWide(uint64_t value) {
+    return value * 0x9E3779B97F4A7C15ull + 1;
+}
+
+const Dispatch<uint64_t(uint64_t)> g_mix{
+    {mixWide, x86LevelFeatureMask(X86Level::v3), "x86-64-v3"},
+    {mixScalar, 0, "scalar"}};
+
+TRLC_DISPATCH_FUNCTION(uint64_t,
+                       mixDispatched,
+                       (uint64_t value),
+                       (value),
+                       {mixWide, x86LevelFeatureMask(X86Level::v3), "x86-64-v3"},
+                       {mixScalar, 0, "scalar"});
+
+/// What dispatch looks like without a resolved pointer: a feature check per call
+uint64_t mixChecked(uint64_t value) {
+    return hasAllRuntimeFeatures(x86LevelFeatureMask(X86Level::v3)) ? mixWide(value)
+                                                                   : mixScalar(value);
+}
+
+}  // namespace
+
+int main() {
+    constexpr size_t iterations = 10000000;
+
+    std::printf("=== Dispatch call overhead (selected: %s) ===\n", g_mix.name());
+
+    const double direct = measureNanosPerOp(iterations, [] {
+        uint64_t value = 1;
+        for (size_t i = 0; i < iterations; ++i) {
+            value = mixScalar(value);
+        }
+        doNotOptimize(value);
+    });
+    reportNanos("Direct call", direct);
+
+    const double dispatched = measureNanosPerOp(iterations, [] {
+        uint64_t value = 1;
+        for (size_t i = 0; i < iterations; ++i) {
+            value = g_mix(value);
+        }
+        doNotOptimize(value);
+    });
+    reportNanos("Dispatch<> call", dispatched);
+
+    const double defined = measureNanosPerOp(iterations, [] {
+        uint64_t value = 1;
+        for (size_t i = 0; i < iterations; ++i) {
+            value = mixDispatched(value);
+        }
+        doNotOptimize(value);
+    });
+    reportNanos(TRLC_PLATFORM_HAS_IFUNC ? "TRLC_DISPATCH_FUNCTION [ifunc]"
+                                        : "TRLC_DISPATCH_FUNCTION [cached pointer]",
+                defined);
+
+    const double checked = measureNanosPerOp(iterations, [] {
+        uint64_t value = 1;
+        for (size_t i = 0; i < iterations; ++i) {
+            value = mixChecked(value);
+        }
+        doNotOptimize(value);
+    });
+    reportNanos("Feature check per call", checked);
+
+    std::printf("  Dispatch overhead: %.2f ns/call\n", dispatched - direct);
+    return 0;
+}
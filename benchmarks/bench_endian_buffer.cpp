@@ -0,0 +1,102 @@
+/**
+ * @file bench_endian_buffer.cpp
+ * @brief Cost of parsing unaligned big-endian headers from a byte stream
+ *
+ * Walks a buffer of back-to-back 15-byte packet headers and sums their
+ * fields three ways: memcpy plus networkToHost() at every call site as
+ * callers did before, loadBE()/loadLE(), and the byte-by-byte assembly
+ * that constant evaluation and strict-alignment targets use. The first two
+ * should be indistinguishable; the point is the call site, not the speed.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "trlc/platform/endian_buffer.hpp"
+
+using namespace trlc::platform;
+using trlc::platform::bench::doNotOptimize;
+using trlc::platform::bench::measureNanosPerOp;
+using trlc::platform::bench::reportNanos;
+
+namespace {
+
+// type (u8), length (u32 BE), sequence (u64 BE), checksum (u16 LE)
+constexpr size_t HEADER_SIZE = 15;
+
+TRLC_NEVER_INLINE uint64_t parseWithMemcpy(const unsigned char* stream, size_t count) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned char* header = stream + i * HEADER_SIZE;
+        uint32_t length;
+        uint64_t sequence;
+        uint16_t checksum;
+        std::memcpy(&length, header + 1, sizeof(length));
+        std::memcpy(&sequence, header + 5, sizeof(sequence));
+        std::memcpy(&checksum, header + 13, sizeof(checksum));
+        sum += header[0] + networkToHost(length) + networkToHost(sequence) +
+               convertByteOrder(checksum, ByteOrder::little_endian, getByteOrder());
+    }
+    return sum;
+}
+
+TRLC_NEVER_INLINE uint64_t parseWithLoads(const unsigned char* stream, size_t count) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned char* header = stream + i * HEADER_SIZE;
+        sum += header[0] + loadBE<uint32_t>(header + 1) + loadBE<uint64_t>(header + 5) +
+               loadLE<uint16_t>(header + 13);
+    }
+    return sum;
+}
+
+TRLC_NEVER_INLINE uint64_t parseBytewise(const unsigned char* stream, size_t count) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned char* header = stream + i * HEADER_SIZE;
+        sum += header[0] + detail::loadBytes<uint32_t>(header + 1, true) +
+               detail::loadBytes<uint64_t>(header + 5, true) +
+               detail::loadBytes<uint16_t>(header + 13, false);
+    }
+    return sum;
+}
+
+void benchParse(const char* title, size_t count, size_t passes) {
+    std::vector<unsigned char> stream(count * HEADER_SIZE);
+    for (size_t i = 0; i < count; ++i) {
+        unsigned char* header = stream.data() + i * HEADER_SIZE;
+        header[0] = static_cast<unsigned char>(i);
+        storeBE<uint32_t>(header + 1, static_cast<uint32_t>(64 + i % 1400));
+        storeBE<uint64_t>(header + 5, i);
+        storeLE<uint16_t>(header + 13, static_cast<uint16_t>(i * 31));
+    }
+    const uint64_t expected = parseWithMemcpy(stream.data(), count);
+    if (parseWithLoads(stream.data(), count) != expected ||
+        parseBytewise(stream.data(), count) != expected) {
+        std::printf("Parsers disagree\n");
+        return;
+    }
+
+    std::printf("\n=== %s: %zu headers ===\n", title, count);
+    auto run = [&](const char* name, uint64_t (*parse)(const unsigned char*, size_t)) {
+        reportNanos(name, measureNanosPerOp(passes * count, [&] {
+                        for (size_t pass = 0; pass < passes; ++pass) {
+                            doNotOptimize(parse(stream.data(), count));
+                        }
+                    }));
+    };
+    run("memcpy + networkToHost()", parseWithMemcpy);
+    run("loadBE()/loadLE()", parseWithLoads);
+    run("byte-by-byte assembly", parseBytewise);
+}
+
+}  // namespace
+
+int main() {
+    benchParse("L1 resident", 1024, 4096);
+    benchParse("Memory bound", size_t(8) << 20, 4);
+    return 0;
+}
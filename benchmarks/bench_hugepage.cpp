@@ -0,0 +1,85 @@
+/**
+ * @file bench_hugepage.cpp
+ * @brief Random access latency on normal pages and huge pages
+ *
+ * Follows a random cyclic chain through a buffer much larger than the TLB
+ * reach of base pages, one hop per cache line. Every hop depends on the
+ * previous load, so the time per hop is load latency including the page
+ * walk on a TLB miss. The same chain runs on each backing HugePageBuffer
+ * can obtain on this system.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "trlc/platform/memory.hpp"
+
+using namespace trlc::platform;
+using trlc::platform::bench::doNotOptimize;
+using trlc::platform::bench::measureNanosPerOp;
+using trlc::platform::bench::reportNanos;
+
+namespace {
+
+constexpr size_t BUFFER_BYTES = size_t(256) << 20;
+constexpr size_t LINE_BYTES = 64;
+constexpr size_t HOPS = 2000000;
+
+/// Link every cache line of the buffer into one random cycle (Sattolo's algorithm)
+void buildChain(HugePageBuffer& buffer) {
+    const size_t slots = buffer.size() / LINE_BYTES;
+    auto* base = static_cast<unsigned char*>(buffer.data());
+
+    std::vector<uint32_t> order(slots);
+    for (size_t i = 0; i < slots; ++i) {
+        order[i] = static_cast<uint32_t>(i);
+    }
+    std::mt19937_64 random(42);
+    for (size_t i = slots - 1; i > 0; --i) {
+        const size_t j = std::uniform_int_distribution<size_t>(0, i - 1)(random);
+        std::swap(order[i], order[j]);
+    }
+    for (size_t i = 0; i < slots; ++i) {
+        *reinterpret_cast<uint32_t*>(base + order[i] * LINE_BYTES) = order[(i + 1) % slots];
+    }
+}
+
+double chase(const HugePageBuffer& buffer) {
+    const auto* base = static_cast<const unsigned char*>(buffer.data());
+    return measureNanosPerOp(HOPS, [base] {
+        uint32_t slot = 0;
+        for (size_t i = 0; i < HOPS; ++i) {
+            slot = *reinterpret_cast<const uint32_t*>(base + size_t(slot) * LINE_BYTES);
+        }
+        doNotOptimize(slot);
+    });
+}
+
+}  // namespace
+
+int main() {
+    std::printf("=== Random access latency over %zu MiB ===\n", BUFFER_BYTES >> 20);
+
+    const HugePageBacking backings[] = {
+        HugePageBacking::normal, HugePageBacking::transparent, HugePageBacking::explicit_pool};
+
+    HugePageBacking previous = HugePageBacking::none;
+    for (HugePageBacking requested : backings) {
+        HugePageBuffer buffer(BUFFER_BYTES, requested);
+        if (buffer.backing() == previous) {
+            continue;  // Fell back to a backing that was already measured
+        }
+        previous = buffer.backing();
+
+        buildChain(buffer);
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s (%zu KiB)", hugePageBackingName(buffer.backing()),
+                      buffer.pageSize() / 1024);
+        reportNanos(label, chase(buffer));
+    }
+    return 0;
+}
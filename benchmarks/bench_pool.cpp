@@ -0,0 +1,151 @@
+/**
+ * @file bench_pool.cpp
+ * @brief Multi-threaded object pool throughput versus the system allocator
+ *
+ * Two patterns are measured. In the local pattern every thread allocates a
+ * batch of small messages and frees them again. In the handoff pattern
+ * producers allocate messages that consumer threads free, which is the
+ * case the pool's shared free list exists for. Results are nanoseconds of
+ * wall time per allocate/free pair across all threads.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "trlc/platform/pool.hpp"
+
+using namespace trlc::platform;
+using trlc::platform::bench::measureNanosPerOp;
+using trlc::platform::bench::reportNanos;
+
+namespace {
+
+struct Message {
+    uint64_t sequence;
+    uint64_t payload[7];
+
+    explicit Message(uint64_t value) : sequence(value), payload{} {}
+};
+
+constexpr size_t BATCH = 128;
+constexpr size_t ROUNDS = 2000;
+
+struct SystemAllocator {
+    Message* create(uint64_t value) { return new Message(value); }
+    void destroy(Message* message) { delete message; }
+};
+
+template <typename Allocator>
+double benchLocal(Allocator& allocator, size_t thread_count) {
+    return measureNanosPerOp(thread_count * ROUNDS * BATCH, [&] {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&allocator] {
+                Message* batch[BATCH];
+                for (size_t round = 0; round < ROUNDS; ++round) {
+                    for (size_t i = 0; i < BATCH; ++i) {
+                        batch[i] = allocator.create(i);
+                    }
+                    for (Message* message : batch) {
+                        allocator.destroy(message);
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    });
+}
+
+/// Single-producer single-consumer ring handing messages to another thread
+struct Handoff {
+    static constexpr size_t CAPACITY = 1024;
+
+    Message* slots[CAPACITY];
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+
+    void push(Message* message) {
+        const size_t position = tail.load(std::memory_order_relaxed);
+        while (position - head.load(std::memory_order_acquire) == CAPACITY) {
+            std::this_thread::yield();
+        }
+        slots[position % CAPACITY] = message;
+        tail.store(position + 1, std::memory_order_release);
+    }
+
+    Message* pop() {
+        const size_t position = head.load(std::memory_order_relaxed);
+        while (tail.load(std::memory_order_acquire) == position) {
+            std::this_thread::yield();
+        }
+        Message* message = slots[position % CAPACITY];
+        head.store(position + 1, std::memory_order_release);
+        return message;
+    }
+};
+
+template <typename Allocator>
+double benchHandoff(Allocator& allocator, size_t pairs) {
+    const size_t messages = ROUNDS * BATCH;
+    return measureNanosPerOp(pairs * messages, [&] {
+        std::vector<Handoff> queues(pairs);
+        std::vector<std::thread> threads;
+        for (size_t p = 0; p < pairs; ++p) {
+            Handoff& queue = queues[p];
+            threads.emplace_back([&allocator, &queue, messages] {
+                for (size_t i = 0; i < messages; ++i) {
+                    queue.push(allocator.create(i));
+                }
+            });
+            threads.emplace_back([&allocator, &queue, messages] {
+                for (size_t i = 0; i < messages; ++i) {
+                    allocator.destroy(queue.pop());
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }, 3);
+}
+
+void report(const char* pattern, size_t threads, const char* allocator, double nanos) {
+    char label[64];
+    std::snprintf(label, sizeof(label), "%s, %zu thread(s), %s", pattern, threads, allocator);
+    reportNanos(label, nanos);
+}
+
+}  // namespace
+
+int main() {
+    std::printf("=== %zu-byte messages, ns per allocate/free pair ===\n", sizeof(Message));
+
+    SystemAllocator system;
+    ObjectPool<Message> pool;
+
+    for (size_t threads : {size_t(1), size_t(2), size_t(4)}) {
+        report("local", threads, "new/delete", benchLocal(system, threads));
+        report("local", threads, "ObjectPool", benchLocal(pool, threads));
+    }
+    for (size_t pairs : {size_t(1), size_t(2)}) {
+        report("handoff", 2 * pairs, "new/delete", benchHandoff(system, pairs));
+        report("handoff", 2 * pairs, "ObjectPool", benchHandoff(pool, pairs));
+    }
+
+    const PoolStats stats = pool.stats();
+    std::printf("\nPool: hit rate %.1f%%, %llu refills, %llu remote frees, %llu flushes, "
+                "%zu slabs, %zu thread caches\n",
+                stats.hitRate() * 100.0,
+                static_cast<unsigned long long>(stats.refills),
+                static_cast<unsigned long long>(stats.remote_frees),
+                static_cast<unsigned long long>(stats.flushes),
+                stats.slab_count,
+                stats.thread_caches);
+    return 0;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file bench_runtime_features.cpp
+ * @brief Cost of runtime CPU feature queries
+ *
+ * Compares the cached feature bitmap used by hasRuntimeFeature() against
+ * executing CPUID for every query, which is what the library did before the
+ * bitmap existed.
+ */
+
+#include <cstdio>
+
+#include "benchmark_utils.hpp"
+#include "trlc/platform/features.hpp"
+
+using namespace trlc::platform;
+using trlc::platform::bench::doNotOptimize;
+using trlc::platform::bench::measureNanosPerOp;
+using trlc::platform::bench::reportNanos;
+
+int main() {
+    constexpr size_t iterations = 1000000;
+
+    std::printf("=== Runtime feature query cost ===\n");
+
+    const double cached = measureNanosPerOp(iterations, [] {
+        for (size_t i = 0; i < iterations; ++i) {
+            doNotOptimize(hasRuntimeFeature(RuntimeFeature::avx2));
+        }
+    });
+    reportNanos("hasRuntimeFeature(avx2) [cached]", cached);
+
+    const double named = measureNanosPerOp(iterations, [] {
+        for (size_t i = 0; i < iterations; ++i) {
+            doNotOptimize(hasSse42Support());
+        }
+    });
+    reportNanos("hasSse42Support() [cached]", named);
+
+#if TRLC_HAS_X86_INTRINSICS
+    constexpr size_t cpuid_iterations = 20000;
+    const double raw = measureNanosPerOp(cpuid_iterations, [] {
+        for (size_t i = 0; i < cpuid_iterations; ++i) {
+            doNotOptimize(detail::checkCpuFeature(7, 0, 1, 5));
+        }
+    });
+    reportNanos("CPUID per query (previous behaviour)", raw);
+    std::printf("  Speedup: %.1fx\n", raw / cached);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file benchmark_utils.hpp
+ * @brief Minimal timing helpers shared by the trlc-platform benchmarks
+ *
+ * The benchmarks are plain executables without an external framework. Each
+ * measurement runs a callable several times and keeps the fastest run, which
+ * filters out most scheduling noise on shared machines.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace trlc::platform::bench {
+
+/**
+ * @brief Prevent the compiler from optimizing away a computed value
+ * @param value Value that must be considered observable
+ */
+template <typename Type>
+inline void doNotOptimize(const Type& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "r,m"(value) : "memory");
+#else
+    const volatile Type* sink = &value;
+    static_cast<void>(sink);
+#endif
+}
+
+/**
+ * @brief Time a callable and return the best nanoseconds per operation
+ *
+ * @param iterations Number of operations performed by one call of @p body
+ * @param body Callable executing @p iterations operations
+ * @param repetitions Number of timed runs; the fastest one is reported
+ * @return Nanoseconds per operation of the fastest run
+ */
+template <typename Body>
+double measureNanosPerOp(size_t iterations, Body&& body, int repetitions = 5) {
+    using Clock = std::chrono::steady_clock;
+
+    body();  // Warm caches, page in memory and resolve lazy state
+
+    double best = 0.0;
+    for (int run = 0; run < repetitions; ++run) {
+        const auto start = Clock::now();
+        body();
+        const auto stop = Clock::now();
+        const double nanos = std::chrono::duration<double, std::nano>(stop - start).count();
+        if (run == 0 || nanos < best) {
+            best = nanos;
+        }
+    }
+    return best / static_cast<double>(iterations);
+}
+
+/**
+ * @brief Print a single benchmark result line in nanoseconds per operation
+ * @param name Benchmark name
+ * @param nanos_per_op Measured nanoseconds per operation
+ */
+inline void reportNanos(const char* name, double nanos_per_op) {
+    std::printf("  %-44s %10.2f ns/op\n", name, nanos_per_op);
+}
+
+/**
+ * @brief Print a single benchmark result line as throughput
+ * @param name Benchmark name
+ * @param bytes_per_op Bytes processed per operation
+ * @param nanos_per_op Measured nanoseconds per operation
+ */
+inline void reportThroughput(const char* name, double bytes_per_op, double nanos_per_op) {
+    std::printf("  %-44s %10.2f GB/s\n", name, bytes_per_op / nanos_per_op);
+}
+
+}  // namespace trlc::platform::bench
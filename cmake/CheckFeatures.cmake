@@ -762,5 +762,21 @@ function(trlc_check_runtime_features)
         set(TRLC_HAS_NEON_SUPPORT FALSE CACHE BOOL "Has NEON compile support")
     endif()
 
+    # Check for GNU indirect functions (resolved by the dynamic loader)
+    if(TRLC_PLATFORM_TYPE STREQUAL "linux")
+        check_cxx_source_compiles("
+            static int implementation() { return 0; }
+            extern \"C\" auto trlc_check_ifunc_resolver() -> int (*)() {
+                return &implementation;
+            }
+            int dispatched() __attribute__((ifunc(\"trlc_check_ifunc_resolver\")));
+            int main() { return dispatched(); }
+        " TRLC_HAS_IFUNC_COMPILE)
+
+        set(TRLC_HAS_IFUNC_SUPPORT ${TRLC_HAS_IFUNC_COMPILE} CACHE BOOL "Has GNU ifunc support")
+    else()
+        set(TRLC_HAS_IFUNC_SUPPORT FALSE CACHE BOOL "Has GNU ifunc support")
+    endif()
+
     message(DEBUG "Runtime features checked")
 endfunction()
@@ -0,0 +1,234 @@
+#pragma once
+
+/**
+ * @file affinity.hpp
+ * @brief Thread pinning driven by the detected processor topology
+ *
+ * Pins the calling thread to CPUs, physical cores or NUMA nodes described
+ * by getCpuTopology(), and computes placements that spread worker threads
+ * over physical cores before sharing a core between SMT siblings.
+ * Pinning is implemented with sched_setaffinity on Linux; on other systems
+ * the functions report failure and leave scheduling to the OS.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "trlc/platform/topology.hpp"
+
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+namespace trlc {
+namespace platform {
+
+/**
+ * @brief Get the CPUs the calling thread may run on
+ * @return CPU numbers in ascending order; empty if the mask cannot be read
+ */
+inline std::vector<int> getCurrentThreadAffinity() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    // Grow the mask until it covers every CPU the kernel knows about
+    for (int max_cpus = CPU_SETSIZE; max_cpus <= (1 << 20); max_cpus *= 2) {
+        cpu_set_t* mask = CPU_ALLOC(max_cpus);
+        if (mask == nullptr) {
+            break;
+        }
+        const size_t size = CPU_ALLOC_SIZE(max_cpus);
+        CPU_ZERO_S(size, mask);
+        const bool ok = sched_getaffinity(0, size, mask) == 0;
+        if (ok) {
+            for (int cpu = 0; cpu < max_cpus; ++cpu) {
+                if (CPU_ISSET_S(cpu, size, mask)) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        CPU_FREE(mask);
+        if (ok) {
+            break;
+        }
+    }
+#endif
+    return cpus;
+}
+
+/**
+ * @brief Restrict the calling thread to a set of CPUs
+ *
+ * CPUs outside the process's own affinity mask or cpuset are rejected by
+ * the kernel; the call then fails and the previous affinity is kept.
+ *
+ * @param cpus CPU numbers the thread may run on
+ * @return true if the affinity was changed
+ */
+inline bool pinCurrentThread(const std::vector<int>& cpus) {
+    if (cpus.empty()) {
+        return false;
+    }
+#if defined(__linux__)
+    const int max_cpu = *std::max_element(cpus.begin(), cpus.end());
+    if (*std::min_element(cpus.begin(), cpus.end()) < 0) {
+        return false;
+    }
+
+    cpu_set_t* mask = CPU_ALLOC(max_cpu + 1);
+    if (mask == nullptr) {
+        return false;
+    }
+    const size_t size = CPU_ALLOC_SIZE(max_cpu + 1);
+    CPU_ZERO_S(size, mask);
+    for (int cpu : cpus) {
+        CPU_SET_S(cpu, size, mask);
+    }
+    const bool ok = sched_setaffinity(0, size, mask) == 0;
+    CPU_FREE(mask);
+    return ok;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Pin the calling thread to a single logical CPU
+ * @param cpu_id CPU number
+ * @return true if the affinity was changed
+ */
+inline bool pinToCpu(int cpu_id) {
+    return pinCurrentThread(std::vector<int>{cpu_id});
+}
+
+/**
+ * @brief Pin the calling thread to the physical core of a logical CPU
+ *
+ * The thread may run on any SMT sibling of that core, which keeps it next
+ * to the core's L1 and L2 caches while letting the OS balance siblings.
+ *
+ * @param cpu_id Any logical CPU of the core
+ * @return true if the affinity was changed
+ */
+inline bool pinToCore(int cpu_id) {
+    const LogicalCpu* cpu = getCpuTopology().find(cpu_id);
+    if (cpu == nullptr) {
+        return false;
+    }
+    return pinCurrentThread(cpu->thread_siblings);
+}
+
+/**
+ * @brief Pin the calling thread to the CPUs of a NUMA node
+ * @param node_id NUMA node ID
+ * @return true if the affinity was changed
+ */
+inline bool pinToNode(int node_id) {
+    return pinCurrentThread(getCpuTopology().cpusInNode(node_id));
+}
+
+/**
+ * @brief Order CPUs so that physical cores are used before SMT siblings
+ *
+ * Returns the first hardware thread of every core, then the second, and
+ * so on. Packages are interleaved within each round, so consecutive
+ * threads also spread over sockets and their memory controllers.
+ *
+ * @param topology Processor topology
+ * @param allowed CPUs that may be used; all CPUs if empty
+ * @return CPU numbers in placement order
+ */
+inline std::vector<int> spreadCpuOrder(const CpuTopology& topology,
+                                       const std::vector<int>& allowed = {}) {
+    auto is_allowed = [&allowed](int cpu_id) {
+        return allowed.empty() ||
+               std::find(allowed.begin(), allowed.end(), cpu_id) != allowed.end();
+    };
+
+    // Position of each CPU among its allowed core siblings, and of its core
+    // within its package
+    struct Slot {
+        size_t thread_rank;
+        size_t core_rank;
+        int package_id;
+        int cpu_id;
+    };
+    std::vector<Slot> slots;
+    for (const LogicalCpu& cpu : topology.cpus) {
+        if (!is_allowed(cpu.cpu_id)) {
+            continue;
+        }
+        size_t thread_rank = 0;
+        for (int sibling : cpu.thread_siblings) {
+            if (sibling < cpu.cpu_id && is_allowed(sibling)) {
+                ++thread_rank;
+            }
+        }
+        const int first_thread = cpu.thread_siblings.empty() ? cpu.cpu_id
+                                                             : cpu.thread_siblings.front();
+        size_t core_rank = 0;
+        for (const LogicalCpu& other : topology.cpus) {
+            if (other.package_id == cpu.package_id && other.cpu_id < first_thread &&
+                !other.thread_siblings.empty() && other.thread_siblings.front() == other.cpu_id) {
+                ++core_rank;
+            }
+        }
+        slots.push_back(Slot{thread_rank, core_rank, cpu.package_id, cpu.cpu_id});
+    }
+
+    std::sort(slots.begin(), slots.end(), [](const Slot& lhs, const Slot& rhs) {
+        if (lhs.thread_rank != rhs.thread_rank) {
+            return lhs.thread_rank < rhs.thread_rank;
+        }
+        if (lhs.core_rank != rhs.core_rank) {
+            return lhs.core_rank < rhs.core_rank;
+        }
+        return lhs.package_id < rhs.package_id;
+    });
+
+    std::vector<int> order;
+    order.reserve(slots.size());
+    for (const Slot& slot : slots) {
+        order.push_back(slot.cpu_id);
+    }
+    return order;
+}
+
+/**
+ * @brief Choose a CPU for each thread of a pool
+ *
+ * Uses the CPUs the calling thread may run on, spread over physical cores
+ * first (see spreadCpuOrder()). With more threads than CPUs the placement
+ * wraps around.
+ *
+ * @param thread_count Number of threads to place
+ * @return CPU number for each thread; empty if no CPU is known
+ *
+ * @example
+ * @code
+ * auto placement = trlc::platform::spreadPlacement(workers);
+ * for (size_t i = 0; i < workers; ++i) {
+ *     threads.emplace_back([cpu = placement[i]] {
+ *         trlc::platform::pinToCpu(cpu);
+ *         // ...
+ *     });
+ * }
+ * @endcode
+ */
+inline std::vector<int> spreadPlacement(size_t thread_count) {
+    const std::vector<int> order = spreadCpuOrder(getCpuTopology(), getCurrentThreadAffinity());
+    std::vector<int> placement;
+    if (order.empty()) {
+        return placement;
+    }
+    placement.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        placement.push_back(order[i % order.size()]);
+    }
+    return placement;
+}
+
+}  // namespace platform
+}  // namespace trlc
@@ -0,0 +1,246 @@
+#pragma once
+
+/**
+ * @file allocator.hpp
+ * @brief Over-aligned allocation for containers and owning pointers
+ *
+ * typeinfo.hpp computes cache line and page alignment; this header
+ * allocates memory with it. AlignedAllocator plugs into std::vector and
+ * other allocator-aware containers, and makeAlignedUnique() creates owning
+ * pointers to over-aligned objects and arrays. Both default to cache-line
+ * alignment, which keeps SIMD loads within one line and stops independent
+ * per-thread data from sharing a line.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "trlc/platform/typeinfo.hpp"
+
+namespace trlc {
+namespace platform {
+
+namespace detail {
+
+/**
+ * @brief Default alignment for a type: a cache line, or more if the type needs it
+ * @tparam Type Element type
+ * @return Alignment in bytes
+ */
+template <typename Type>
+constexpr size_t defaultAlignment() noexcept {
+    return std::max(getCacheLineSize(), alignof(Type));
+}
+
+/**
+ * @brief Allocate raw storage with an explicit alignment
+ * @param bytes Size in bytes
+ * @param alignment Power-of-two alignment
+ * @return Storage; throws std::bad_alloc on failure
+ */
+inline void* allocateAligned(size_t bytes, size_t alignment) {
+    return ::operator new(bytes, std::align_val_t(alignment));
+}
+
+/**
+ * @brief Release storage from allocateAligned()
+ * @param memory Storage
+ * @param alignment Alignment passed to allocateAligned()
+ */
+inline void deallocateAligned(void* memory, size_t alignment) noexcept {
+    ::operator delete(memory, std::align_val_t(alignment));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Standard allocator returning memory aligned to @p Alignment
+ *
+ * Every allocation starts on an @p Alignment boundary. Allocators of the
+ * same alignment are interchangeable, so containers can swap and move their
+ * storage freely.
+ *
+ * @tparam Type Element type
+ * @tparam Alignment Power-of-two alignment, at least alignof(Type)
+ *
+ * @example
+ * @code
+ * std::vector<float, trlc::platform::AlignedAllocator<float>> samples(1024);
+ * // samples.data() is cache-line aligned
+ * @endcode
+ */
+template <typename Type, size_t Alignment = detail::defaultAlignment<Type>()>
+class AlignedAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(Type), "Alignment must satisfy the type's own alignment");
+
+public:
+    using value_type = Type;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    /// Alignment of every allocation in bytes
+    static constexpr size_t alignment = Alignment;
+
+    template <typename Other>
+    struct rebind {
+        using other = AlignedAllocator<Other, std::max(Alignment, alignof(Other))>;
+    };
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template <typename Other, size_t OtherAlignment>
+    constexpr AlignedAllocator(const AlignedAllocator<Other, OtherAlignment>&) noexcept {}
+
+    /**
+     * @brief Allocate storage for @p count objects
+     * @param count Number of objects
+     * @return Aligned, uninitialized storage; throws std::bad_alloc on failure
+     */
+    Type* allocate(size_t count) {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<Type*>(detail::allocateAligned(count * sizeof(Type), Alignment));
+    }
+
+    /**
+     * @brief Release storage from allocate()
+     * @param memory Storage
+     * @param count Number of objects passed to allocate()
+     */
+    void deallocate(Type* memory, size_t count) noexcept {
+        static_cast<void>(count);
+        detail::deallocateAligned(memory, Alignment);
+    }
+};
+
+template <typename Type, size_t Alignment, typename Other, size_t OtherAlignment>
+constexpr bool operator==(const AlignedAllocator<Type, Alignment>&,
+                          const AlignedAllocator<Other, OtherAlignment>&) noexcept {
+    return Alignment == OtherAlignment;
+}
+
+template <typename Type, size_t Alignment, typename Other, size_t OtherAlignment>
+constexpr bool operator!=(const AlignedAllocator<Type, Alignment>& lhs,
+                          const AlignedAllocator<Other, OtherAlignment>& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Deleter for objects created by makeAlignedUnique()
+ * @tparam Type Object type
+ * @tparam Alignment Alignment the storage was allocated with
+ */
+template <typename Type, size_t Alignment>
+struct AlignedDeleter {
+    void operator()(Type* object) const noexcept {
+        object->~Type();
+        detail::deallocateAligned(object, Alignment);
+    }
+};
+
+/**
+ * @brief Deleter for arrays created by makeAlignedUnique()
+ *
+ * Remembers the element count so that every element is destroyed.
+ *
+ * @tparam Type Element type
+ * @tparam Alignment Alignment the storage was allocated with
+ */
+template <typename Type, size_t Alignment>
+struct AlignedDeleter<Type[], Alignment> {
+    size_t count = 0;  ///< Number of constructed elements
+
+    void operator()(Type* elements) const noexcept {
+        for (size_t i = count; i > 0; --i) {
+            elements[i - 1].~Type();
+        }
+        detail::deallocateAligned(elements, Alignment);
+    }
+};
+
+/**
+ * @brief Owning pointer to an over-aligned object or array
+ * @tparam Type Object type, or `Element[]` for arrays
+ * @tparam Alignment Alignment of the storage
+ */
+template <typename Type,
+          size_t Alignment = detail::defaultAlignment<std::remove_extent_t<Type>>()>
+using AlignedUniquePtr = std::unique_ptr<Type, AlignedDeleter<Type, Alignment>>;
+
+/**
+ * @brief Create an over-aligned object
+ * @tparam Type Object type (not an array)
+ * @tparam Alignment Power-of-two alignment, at least alignof(Type)
+ * @param args Constructor arguments
+ * @return Owning pointer to the object
+ */
+template <typename Type,
+          size_t Alignment = detail::defaultAlignment<Type>(),
+          typename... Args,
+          std::enable_if_t<!std::is_array<Type>::value, int> = 0>
+AlignedUniquePtr<Type, Alignment> makeAlignedUnique(Args&&... args) {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(Type), "Alignment must satisfy the type's own alignment");
+
+    void* memory = detail::allocateAligned(sizeof(Type), Alignment);
+    try {
+        return AlignedUniquePtr<Type, Alignment>(new (memory) Type(std::forward<Args>(args)...));
+    } catch (...) {
+        detail::deallocateAligned(memory, Alignment);
+        throw;
+    }
+}
+
+/**
+ * @brief Create an over-aligned array of value-initialized elements
+ *
+ * The first element starts on an @p Alignment boundary, so the array is
+ * suitable for aligned SIMD loads.
+ *
+ * @tparam Type Array type `Element[]`
+ * @tparam Alignment Power-of-two alignment, at least alignof(Element)
+ * @param count Number of elements
+ * @return Owning pointer to the array
+ *
+ * @example
+ * @code
+ * auto buffer = trlc::platform::makeAlignedUnique<float[]>(4096);
+ * buffer[0] = 1.0f;
+ * @endcode
+ */
+template <typename Type,
+          size_t Alignment = detail::defaultAlignment<std::remove_extent_t<Type>>(),
+          std::enable_if_t<std::is_array<Type>::value && std::extent<Type>::value == 0, int> = 0>
+AlignedUniquePtr<Type, Alignment> makeAlignedUnique(size_t count) {
+    using Element = std::remove_extent_t<Type>;
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(Element),
+                  "Alignment must satisfy the type's own alignment");
+
+    AlignedAllocator<Element, Alignment> allocator;
+    Element* elements = allocator.allocate(std::max<size_t>(count, 1));
+    size_t constructed = 0;
+    try {
+        for (; constructed < count; ++constructed) {
+            new (elements + constructed) Element();
+        }
+    } catch (...) {
+        AlignedDeleter<Type, Alignment>{constructed}(elements);
+        throw;
+    }
+    return AlignedUniquePtr<Type, Alignment>(elements, AlignedDeleter<Type, Alignment>{count});
+}
+
+}  // namespace platform
+}  // namespace trlc
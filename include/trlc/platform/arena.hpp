@@ -0,0 +1,326 @@
+#pragma once
+
+/**
+ * @file arena.hpp
+ * @brief Monotonic bump-pointer arena for request-scoped allocations
+ *
+ * An Arena hands out memory by advancing a pointer through large chunks
+ * and frees everything at once. Individual deallocation is a no-op, so
+ * objects that live and die together (one request, one frame, one parse)
+ * cost a few instructions each instead of a trip through the general
+ * purpose allocator. Chunks are sized in whole pages and kept across
+ * reset(), so a steady-state workload stops allocating after warm-up.
+ * ArenaResource adapts an arena to std::pmr containers.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#include "trlc/platform/allocator.hpp"
+#include "trlc/platform/macros.hpp"
+#include "trlc/platform/memory.hpp"
+#include "trlc/platform/typeinfo.hpp"
+
+#if defined(__has_include)
+    #if __has_include(<memory_resource>)
+        #include <memory_resource>
+    #endif
+#endif
+
+namespace trlc {
+namespace platform {
+
+namespace detail {
+
+/**
+ * @brief Header at the start of every heap chunk owned by an Arena
+ */
+struct ArenaChunk {
+    ArenaChunk* next;  ///< Next chunk in allocation order
+    size_t size;       ///< Chunk size in bytes, including this header
+
+    unsigned char* begin() noexcept {
+        return reinterpret_cast<unsigned char*>(this) + sizeof(ArenaChunk);
+    }
+    unsigned char* end() noexcept { return reinterpret_cast<unsigned char*>(this) + size; }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Monotonic bump-pointer allocator
+ *
+ * Allocations are carved from the current chunk; when it is exhausted the
+ * next retained chunk is used, or a new one is allocated that is at least
+ * twice as large as the previous one, rounded to whole pages. Deallocation
+ * of single blocks is not supported: reset() rewinds to the first block in
+ * O(1) and keeps all chunks for reuse, release() returns the chunks to the
+ * system. Destructors of objects placed in the arena are not run.
+ *
+ * An optional caller-provided initial block (see InlineArena) is used
+ * before any heap chunk, so small workloads never allocate at all.
+ *
+ * Not thread-safe; use one arena per thread or per request.
+ *
+ * @example
+ * @code
+ * trlc::platform::Arena arena;
+ * auto* header = static_cast<Header*>(arena.allocate(sizeof(Header), alignof(Header)));
+ * void* rows = arena.allocateCacheAligned(row_bytes);
+ * // ...
+ * arena.reset();  // Everything above is gone, the chunks stay
+ * @endcode
+ */
+class Arena {
+public:
+    /// Alignment used when none is requested
+    static constexpr size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+    /// Largest size chunk growth doubles up to
+    static constexpr size_t MAX_GROWTH_CHUNK_SIZE = size_t(16) << 20;
+
+    /**
+     * @brief Create an empty arena
+     * @param chunk_size Size of the first heap chunk; 0 for one page. Rounded
+     *        up to whole pages.
+     */
+    explicit Arena(size_t chunk_size = 0) noexcept : Arena(nullptr, 0, chunk_size) {}
+
+    /**
+     * @brief Create an arena that starts in a caller-provided block
+     * @param initial_block Memory used before any heap chunk; must outlive the arena
+     * @param initial_size Size of @p initial_block in bytes
+     * @param chunk_size Size of the first heap chunk; 0 for one page. Rounded
+     *        up to whole pages.
+     */
+    Arena(void* initial_block, size_t initial_size, size_t chunk_size = 0) noexcept
+        : _initial(static_cast<unsigned char*>(initial_block)),
+          _initial_size(initial_block != nullptr ? initial_size : 0),
+          _chunk_size(alignedSize(std::max<size_t>(chunk_size, 1), getRuntimePageSize())),
+          _next_chunk_size(_chunk_size),
+          _capacity(_initial_size) {
+        reset();
+    }
+
+    ~Arena() { release(); }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Allocate uninitialized memory
+     * @param bytes Size in bytes
+     * @param alignment Power-of-two alignment
+     * @return Memory valid until reset() or release(); throws std::bad_alloc on failure
+     */
+    void* allocate(size_t bytes, size_t alignment = DEFAULT_ALIGNMENT) {
+        const uintptr_t address = alignedAddress(reinterpret_cast<uintptr_t>(_cursor), alignment);
+        const auto end = reinterpret_cast<uintptr_t>(_end);
+        if (TRLC_LIKELY(address < end && bytes <= end - address)) {
+            _cursor = reinterpret_cast<unsigned char*>(address + bytes);
+            _allocated += bytes;
+            return reinterpret_cast<void*>(address);
+        }
+        return allocateFromNextChunk(bytes, alignment);
+    }
+
+    /**
+     * @brief Allocate memory starting on a cache line boundary
+     *
+     * Keeps independently written blocks, such as per-thread counters
+     * carved from a shared arena, from sharing a cache line.
+     *
+     * @param bytes Size in bytes
+     * @return Memory valid until reset() or release(); throws std::bad_alloc on failure
+     */
+    void* allocateCacheAligned(size_t bytes) {
+        return allocate(alignedSize(bytes, getCacheLineSize()), getCacheLineSize());
+    }
+
+    /**
+     * @brief Discard all allocations and keep the chunks for reuse
+     *
+     * Runs in constant time regardless of how much was allocated.
+     */
+    void reset() noexcept {
+        _allocated = 0;
+        if (_initial_size != 0) {
+            _current = nullptr;
+            _cursor = _initial;
+            _end = _initial + _initial_size;
+        } else if (_chunks != nullptr) {
+            _current = _chunks;
+            _cursor = _chunks->begin();
+            _end = _chunks->end();
+        } else {
+            _current = nullptr;
+            _cursor = nullptr;
+            _end = nullptr;
+        }
+    }
+
+    /**
+     * @brief Discard all allocations and free every heap chunk
+     */
+    void release() noexcept {
+        for (detail::ArenaChunk* chunk = _chunks; chunk != nullptr;) {
+            detail::ArenaChunk* next = chunk->next;
+            detail::deallocateAligned(chunk, getCacheLineSize());
+            chunk = next;
+        }
+        _chunks = nullptr;
+        _last = nullptr;
+        _chunk_count = 0;
+        _capacity = _initial_size;
+        _next_chunk_size = _chunk_size;
+        reset();
+    }
+
+    /// @return Bytes requested since the last reset(), excluding padding
+    size_t bytesAllocated() const noexcept { return _allocated; }
+
+    /// @return Usable bytes in the initial block and all heap chunks
+    size_t capacity() const noexcept { return _capacity; }
+
+    /// @return Number of heap chunks currently owned
+    size_t chunkCount() const noexcept { return _chunk_count; }
+
+private:
+    TRLC_NEVER_INLINE void* allocateFromNextChunk(size_t bytes, size_t alignment) {
+        // Chunks retained from before the last reset() come first
+        detail::ArenaChunk* chunk = _current != nullptr ? _current->next : _chunks;
+        for (; chunk != nullptr; chunk = chunk->next) {
+            if (void* memory = allocateFrom(chunk, bytes, alignment)) {
+                return memory;
+            }
+        }
+
+        const size_t header = sizeof(detail::ArenaChunk);
+        if (bytes > std::numeric_limits<size_t>::max() / 2 - header - alignment) {
+            throw std::bad_alloc();
+        }
+        const size_t size = alignedSize(std::max(_next_chunk_size, header + alignment + bytes),
+                                        getRuntimePageSize());
+        chunk = static_cast<detail::ArenaChunk*>(
+            detail::allocateAligned(size, getCacheLineSize()));
+        chunk->next = nullptr;
+        chunk->size = size;
+
+        if (_last != nullptr) {
+            _last->next = chunk;
+        } else {
+            _chunks = chunk;
+        }
+        _last = chunk;
+        ++_chunk_count;
+        _capacity += size - header;
+        _next_chunk_size = std::max(_next_chunk_size, std::min(size * 2, MAX_GROWTH_CHUNK_SIZE));
+
+        return allocateFrom(chunk, bytes, alignment);
+    }
+
+    void* allocateFrom(detail::ArenaChunk* chunk, size_t bytes, size_t alignment) noexcept {
+        const uintptr_t address =
+            alignedAddress(reinterpret_cast<uintptr_t>(chunk->begin()), alignment);
+        const auto end = reinterpret_cast<uintptr_t>(chunk->end());
+        if (address >= end || bytes > end - address) {
+            return nullptr;
+        }
+        _current = chunk;
+        _cursor = reinterpret_cast<unsigned char*>(address + bytes);
+        _end = chunk->end();
+        _allocated += bytes;
+        return reinterpret_cast<void*>(address);
+    }
+
+    // Bump state of the block in use, kept first for the fast path
+    unsigned char* _cursor = nullptr;
+    unsigned char* _end = nullptr;
+    size_t _allocated = 0;
+
+    unsigned char* _initial;
+    size_t _initial_size;
+    detail::ArenaChunk* _current = nullptr;  ///< Chunk in use; nullptr for the initial block
+    detail::ArenaChunk* _chunks = nullptr;   ///< First heap chunk
+    detail::ArenaChunk* _last = nullptr;     ///< Last heap chunk
+    size_t _chunk_size;
+    size_t _next_chunk_size;
+    size_t _chunk_count = 0;
+    size_t _capacity;
+};
+
+/**
+ * @brief Arena whose first block is stored inside the object
+ *
+ * Placed on the stack, it serves small workloads without touching the heap
+ * and grows into page-sized chunks only when @p InlineSize is exceeded.
+ *
+ * @tparam InlineSize Size of the embedded block in bytes
+ */
+template <size_t InlineSize>
+class InlineArena : public Arena {
+    static_assert(InlineSize > 0, "InlineSize must not be zero");
+
+public:
+    /**
+     * @brief Create an arena that starts in its embedded block
+     * @param chunk_size Size of the first heap chunk; 0 for one page
+     */
+    explicit InlineArena(size_t chunk_size = 0) noexcept
+        : Arena(_storage, InlineSize, chunk_size) {}
+
+private:
+    alignas(getCacheLineSize()) unsigned char _storage[InlineSize];
+};
+
+#if defined(__cpp_lib_memory_resource)
+
+/**
+ * @brief std::pmr::memory_resource that allocates from an Arena
+ *
+ * deallocate() is a no-op; memory is reclaimed by resetting the arena,
+ * which must not happen while containers still use it. Like
+ * std::pmr::monotonic_buffer_resource, a resource compares equal only to
+ * itself.
+ *
+ * @example
+ * @code
+ * trlc::platform::InlineArena<4096> arena;
+ * trlc::platform::ArenaResource resource(arena);
+ * std::pmr::vector<int> values(&resource);
+ * @endcode
+ */
+class ArenaResource : public std::pmr::memory_resource {
+public:
+    explicit ArenaResource(Arena& arena) noexcept : _arena(&arena) {}
+
+    /// @return Arena backing this resource
+    Arena& arena() const noexcept { return *_arena; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        return _arena->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* memory, size_t bytes, size_t alignment) override {
+        static_cast<void>(memory);
+        static_cast<void>(bytes);
+        static_cast<void>(alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    Arena* _arena;
+};
+
+#endif
+
+}  // namespace platform
+}  // namespace trlc
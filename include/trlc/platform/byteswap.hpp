@@ -0,0 +1,475 @@
+#pragma once
+
+/**
+ * @file byteswap.hpp
+ * @brief Vectorized byte swapping of whole arrays
+ *
+ * byteSwap() in endianness.hpp converts a single value. The functions here
+ * convert arrays of 16-, 32-, 64- and 128-bit elements, such as a
+ * big-endian column read from a wire format, with byte shuffles: PSHUFB on
+ * SSSE3, AVX2 and AVX-512BW, and REV on NEON. Elements may be integers,
+ * float, double or enumerations; only their size matters to the kernels.
+ * The widest kernel the CPU supports is selected once through Dispatch; a
+ * scalar loop serves every other CPU.
+ *
+ * convertByteOrder() and the bulk hostToNetwork()/networkToHost() build on
+ * them and skip the work entirely when the byte orders already match.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "trlc/platform/dispatch.hpp"
+#include "trlc/platform/endianness.hpp"
+#include "trlc/platform/features.hpp"
+#include "trlc/platform/macros.hpp"
+
+#if defined(__has_include)
+    #if __has_include(<span>)
+        #include <span>
+    #endif
+#endif
+
+// Kernels are compiled where the toolchain can target the instruction set
+#if TRLC_HAS_X86_INTRINSICS
+    #define TRLC_BYTESWAP_HAS_SSSE3 1
+    #define TRLC_BYTESWAP_HAS_AVX2 1
+    #if defined(__x86_64__) || defined(_M_X64)
+        #define TRLC_BYTESWAP_HAS_AVX512 1
+    #else
+        #define TRLC_BYTESWAP_HAS_AVX512 0  // 64-bit lane masks need x86-64
+    #endif
+#else
+    #define TRLC_BYTESWAP_HAS_SSSE3 0
+    #define TRLC_BYTESWAP_HAS_AVX2 0
+    #define TRLC_BYTESWAP_HAS_AVX512 0
+#endif
+
+#if TRLC_HAS_ARM_INTRINSICS && defined(__ARM_NEON) && (defined(__GNUC__) || defined(__clang__))
+    #define TRLC_BYTESWAP_HAS_NEON 1
+#else
+    #define TRLC_BYTESWAP_HAS_NEON 0
+#endif
+
+namespace trlc {
+namespace platform {
+
+namespace detail {
+
+/// Unsigned integer of @p Size bytes
+template <size_t Size>
+using ByteSwapWord = UnsignedBits<Size>;
+
+/// Kernel converting @p count elements from @p source to @p destination
+using ByteSwapKernel = void(const void* source, void* destination, size_t count);
+
+/**
+ * @brief PSHUFB control reversing each @p Size byte element of a 64-byte vector
+ *
+ * Shuffles select within 16-byte lanes, so the pattern repeats every lane.
+ */
+template <size_t Size>
+constexpr std::array<uint8_t, 64> makeByteSwapShuffle() noexcept {
+    std::array<uint8_t, 64> shuffle{};
+    for (size_t i = 0; i < shuffle.size(); ++i) {
+        const size_t lane_byte = i % 16;
+        shuffle[i] = static_cast<uint8_t>(lane_byte / Size * Size + Size - 1 - lane_byte % Size);
+    }
+    return shuffle;
+}
+
+template <size_t Size>
+alignas(64) inline constexpr std::array<uint8_t, 64> BYTE_SWAP_SHUFFLE =
+    makeByteSwapShuffle<Size>();
+
+template <size_t Size>
+void byteSwapScalar(const void* source, void* destination, size_t count) noexcept {
+    using Word = ByteSwapWord<Size>;
+    const auto* in = static_cast<const unsigned char*>(source);
+    auto* out = static_cast<unsigned char*>(destination);
+    for (size_t i = 0; i < count; ++i) {
+        Word word;
+        std::memcpy(&word, in + i * Size, Size);
+        word = byteSwap(word);
+        std::memcpy(out + i * Size, &word, Size);
+    }
+}
+
+#if TRLC_BYTESWAP_HAS_SSSE3
+template <size_t Size>
+TRLC_TARGET("ssse3")
+void byteSwapSsse3(const void* source, void* destination, size_t count) noexcept {
+    const auto* in = static_cast<const unsigned char*>(source);
+    auto* out = static_cast<unsigned char*>(destination);
+    const size_t bytes = count * Size;
+    const __m128i shuffle =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(BYTE_SWAP_SHUFFLE<Size>.data()));
+
+    size_t offset = 0;
+    for (; offset + 64 <= bytes; offset += 64) {
+        const auto* block = reinterpret_cast<const __m128i*>(in + offset);
+        const __m128i v0 = _mm_shuffle_epi8(_mm_loadu_si128(block + 0), shuffle);
+        const __m128i v1 = _mm_shuffle_epi8(_mm_loadu_si128(block + 1), shuffle);
+        const __m128i v2 = _mm_shuffle_epi8(_mm_loadu_si128(block + 2), shuffle);
+        const __m128i v3 = _mm_shuffle_epi8(_mm_loadu_si128(block + 3), shuffle);
+        auto* target = reinterpret_cast<__m128i*>(out + offset);
+        _mm_storeu_si128(target + 0, v0);
+        _mm_storeu_si128(target + 1, v1);
+        _mm_storeu_si128(target + 2, v2);
+        _mm_storeu_si128(target + 3, v3);
+    }
+    for (; offset + 16 <= bytes; offset += 16) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + offset),
+                         _mm_shuffle_epi8(value, shuffle));
+    }
+    byteSwapScalar<Size>(in + offset, out + offset, (bytes - offset) / Size);
+}
+#endif
+
+#if TRLC_BYTESWAP_HAS_AVX2
+template <size_t Size>
+TRLC_TARGET("avx2")
+void byteSwapAvx2(const void* source, void* destination, size_t count) noexcept {
+    const auto* in = static_cast<const unsigned char*>(source);
+    auto* out = static_cast<unsigned char*>(destination);
+    const size_t bytes = count * Size;
+    const __m256i shuffle =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(BYTE_SWAP_SHUFFLE<Size>.data()));
+
+    size_t offset = 0;
+    for (; offset + 128 <= bytes; offset += 128) {
+        const auto* block = reinterpret_cast<const __m256i*>(in + offset);
+        const __m256i v0 = _mm256_shuffle_epi8(_mm256_loadu_si256(block + 0), shuffle);
+        const __m256i v1 = _mm256_shuffle_epi8(_mm256_loadu_si256(block + 1), shuffle);
+        const __m256i v2 = _mm256_shuffle_epi8(_mm256_loadu_si256(block + 2), shuffle);
+        const __m256i v3 = _mm256_shuffle_epi8(_mm256_loadu_si256(block + 3), shuffle);
+        auto* target = reinterpret_cast<__m256i*>(out + offset);
+        _mm256_storeu_si256(target + 0, v0);
+        _mm256_storeu_si256(target + 1, v1);
+        _mm256_storeu_si256(target + 2, v2);
+        _mm256_storeu_si256(target + 3, v3);
+    }
+    for (; offset + 32 <= bytes; offset += 32) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + offset));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + offset),
+                            _mm256_shuffle_epi8(value, shuffle));
+    }
+    byteSwapScalar<Size>(in + offset, out + offset, (bytes - offset) / Size);
+}
+#endif
+
+#if TRLC_BYTESWAP_HAS_AVX512
+template <size_t Size>
+TRLC_TARGET("avx512f,avx512bw")
+void byteSwapAvx512(const void* source, void* destination, size_t count) noexcept {
+    const auto* in = static_cast<const unsigned char*>(source);
+    auto* out = static_cast<unsigned char*>(destination);
+    const size_t bytes = count * Size;
+    const __m512i shuffle = _mm512_loadu_si512(BYTE_SWAP_SHUFFLE<Size>.data());
+
+    size_t offset = 0;
+    for (; offset + 256 <= bytes; offset += 256) {
+        const __m512i v0 = _mm512_shuffle_epi8(_mm512_loadu_si512(in + offset + 0), shuffle);
+        const __m512i v1 = _mm512_shuffle_epi8(_mm512_loadu_si512(in + offset + 64), shuffle);
+        const __m512i v2 = _mm512_shuffle_epi8(_mm512_loadu_si512(in + offset + 128), shuffle);
+        const __m512i v3 = _mm512_shuffle_epi8(_mm512_loadu_si512(in + offset + 192), shuffle);
+        _mm512_storeu_si512(out + offset + 0, v0);
+        _mm512_storeu_si512(out + offset + 64, v1);
+        _mm512_storeu_si512(out + offset + 128, v2);
+        _mm512_storeu_si512(out + offset + 192, v3);
+    }
+    for (; offset + 64 <= bytes; offset += 64) {
+        const __m512i value = _mm512_loadu_si512(in + offset);
+        _mm512_storeu_si512(out + offset, _mm512_shuffle_epi8(value, shuffle));
+    }
+
+    // The remaining whole elements are handled with a masked load and store
+    const size_t rest = bytes - offset;
+    if (rest != 0) {
+        const __mmask64 mask = (uint64_t(1) << rest) - 1;
+        const __m512i value = _mm512_maskz_loadu_epi8(mask, in + offset);
+        _mm512_mask_storeu_epi8(out + offset, mask, _mm512_shuffle_epi8(value, shuffle));
+    }
+}
+#endif
+
+#if TRLC_BYTESWAP_HAS_NEON
+template <size_t Size>
+inline uint8x16_t reverseElementBytes(uint8x16_t value) noexcept {
+    if constexpr (Size == 2) {
+        return vrev16q_u8(value);
+    } else if constexpr (Size == 4) {
+        return vrev32q_u8(value);
+    } else if constexpr (Size == 8) {
+        return vrev64q_u8(value);
+    } else {
+        // Reverse each half, then swap the halves
+        const uint8x16_t halves = vrev64q_u8(value);
+        return vextq_u8(halves, halves, 8);
+    }
+}
+
+template <size_t Size>
+void byteSwapNeon(const void* source, void* destination, size_t count) noexcept {
+    const auto* in = static_cast<const uint8_t*>(source);
+    auto* out = static_cast<uint8_t*>(destination);
+    const size_t bytes = count * Size;
+
+    size_t offset = 0;
+    for (; offset + 64 <= bytes; offset += 64) {
+        const uint8x16_t v0 = reverseElementBytes<Size>(vld1q_u8(in + offset + 0));
+        const uint8x16_t v1 = reverseElementBytes<Size>(vld1q_u8(in + offset + 16));
+        const uint8x16_t v2 = reverseElementBytes<Size>(vld1q_u8(in + offset + 32));
+        const uint8x16_t v3 = reverseElementBytes<Size>(vld1q_u8(in + offset + 48));
+        vst1q_u8(out + offset + 0, v0);
+        vst1q_u8(out + offset + 16, v1);
+        vst1q_u8(out + offset + 32, v2);
+        vst1q_u8(out + offset + 48, v3);
+    }
+    for (; offset + 16 <= bytes; offset += 16) {
+        vst1q_u8(out + offset, reverseElementBytes<Size>(vld1q_u8(in + offset)));
+    }
+    byteSwapScalar<Size>(in + offset, out + offset, (bytes - offset) / Size);
+}
+#endif
+
+/**
+ * @brief Choose the byte swap kernel for @p Size byte elements
+ * @param available_features Feature bitmap to select against
+ * @return Dispatch holding the best kernel within @p available_features
+ */
+template <size_t Size>
+inline Dispatch<ByteSwapKernel> selectByteSwapKernel(uint64_t available_features) noexcept {
+    return Dispatch<ByteSwapKernel>(
+        {
+#if TRLC_BYTESWAP_HAS_AVX512
+            {byteSwapAvx512<Size>,
+             runtimeFeatureMask({RuntimeFeature::avx512f, RuntimeFeature::avx512bw}),
+             "avx512bw"},
+#endif
+#if TRLC_BYTESWAP_HAS_AVX2
+            {byteSwapAvx2<Size>, runtimeFeatureMask({RuntimeFeature::avx2}), "avx2"},
+#endif
+#if TRLC_BYTESWAP_HAS_SSSE3
+            {byteSwapSsse3<Size>, runtimeFeatureMask({RuntimeFeature::ssse3}), "ssse3"},
+#endif
+#if TRLC_BYTESWAP_HAS_NEON
+            {byteSwapNeon<Size>, runtimeFeatureMask({RuntimeFeature::neon}), "neon"},
+#endif
+            {byteSwapScalar<Size>, 0, "scalar"}},
+        available_features);
+}
+
+/// Kernel for @p Size byte elements on the running CPU, selected at first use
+template <size_t Size>
+inline const Dispatch<ByteSwapKernel>& byteSwapKernel() noexcept {
+    static const Dispatch<ByteSwapKernel> kernel = selectByteSwapKernel<Size>(cpuFeatureBits());
+    return kernel;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Get the name of the bulk byte swap kernel used on this CPU
+ * @return "avx512bw", "avx2", "ssse3", "neon" or "scalar"
+ */
+inline const char* byteSwapImplementation() noexcept {
+    return detail::byteSwapKernel<4>().name();
+}
+
+/**
+ * @brief Reverse the byte order of every element of an array
+ *
+ * @tparam Type Integer, float, double or enumeration type; see byteSwap()
+ * @param data First element; need not be aligned
+ * @param count Number of elements
+ *
+ * @example
+ * @code
+ * std::vector<uint32_t> column = readColumn(file);
+ * trlc::platform::byteSwapInPlace(column.data(), column.size());
+ * @endcode
+ */
+template <typename Type>
+void byteSwapInPlace(Type* data, size_t count) noexcept {
+    static_assert(detail::isByteSwappable<Type>(),
+                  "byteSwapInPlace supports integers, float, double and enumerations");
+    if constexpr (sizeof(Type) > 1) {
+        detail::byteSwapKernel<sizeof(Type)>()(data, data, count);
+    }
+}
+
+/**
+ * @brief Copy an array, reversing the byte order of every element
+ *
+ * @tparam Type Integer, float, double or enumeration type; see byteSwap()
+ * @param source Elements to convert
+ * @param destination Output for @p count elements; may equal @p source but
+ *        must not otherwise overlap it
+ * @param count Number of elements
+ */
+template <typename Type>
+void byteSwapCopy(const Type* source, Type* destination, size_t count) noexcept {
+    static_assert(detail::isByteSwappable<Type>(),
+                  "byteSwapCopy supports integers, float, double and enumerations");
+    if constexpr (sizeof(Type) > 1) {
+        detail::byteSwapKernel<sizeof(Type)>()(source, destination, count);
+    } else if (count != 0 && source != destination) {
+        std::memcpy(destination, source, count);
+    }
+}
+
+/**
+ * @brief Convert an array in place between two byte orders
+ *
+ * Does nothing when the orders match, so callers need not special-case
+ * the native order.
+ *
+ * @tparam Type Integer, float, double or enumeration type; see byteSwap()
+ * @param data First element
+ * @param count Number of elements
+ * @param from_order Byte order of the data
+ * @param to_order Requested byte order
+ */
+template <typename Type>
+void convertByteOrderInPlace(Type* data,
+                             size_t count,
+                             ByteOrder from_order,
+                             ByteOrder to_order) noexcept {
+    if (!areByteOrdersCompatible(from_order, to_order)) {
+        byteSwapInPlace(data, count);
+    }
+}
+
+/**
+ * @brief Copy an array, converting it between two byte orders
+ *
+ * When the orders match this is a single memcpy, or nothing at all if
+ * @p source and @p destination are the same; otherwise the elements are
+ * swapped with the bulk kernel.
+ *
+ * @tparam Type Integer, float, double or enumeration type; see byteSwap()
+ * @param source Elements to convert
+ * @param destination Output for @p count elements; may equal @p source but
+ *        must not otherwise overlap it
+ * @param count Number of elements
+ * @param from_order Byte order of @p source
+ * @param to_order Byte order to write to @p destination
+ */
+template <typename Type>
+void convertByteOrder(const Type* source,
+                      Type* destination,
+                      size_t count,
+                      ByteOrder from_order,
+                      ByteOrder to_order) noexcept {
+    if (!areByteOrdersCompatible(from_order, to_order)) {
+        byteSwapCopy(source, destination, count);
+    } else if (count != 0 && source != destination) {
+        std::memcpy(destination, source, count * sizeof(Type));
+    }
+}
+
+/**
+ * @brief Copy an array from host to network (big-endian) byte order
+ * @param source Elements in host order
+ * @param destination Output for @p count elements
+ * @param count Number of elements
+ */
+template <typename Type>
+void hostToNetwork(const Type* source, Type* destination, size_t count) noexcept {
+    convertByteOrder(source, destination, count, getByteOrder(), ByteOrder::big_endian);
+}
+
+/**
+ * @brief Copy an array from network (big-endian) to host byte order
+ * @param source Elements in network order
+ * @param destination Output for @p count elements
+ * @param count Number of elements
+ */
+template <typename Type>
+void networkToHost(const Type* source, Type* destination, size_t count) noexcept {
+    convertByteOrder(source, destination, count, ByteOrder::big_endian, getByteOrder());
+}
+
+#if defined(__cpp_lib_span)
+
+/**
+ * @brief Reverse the byte order of every element of a span
+ * @param data Elements to convert
+ */
+template <typename Type, size_t Extent>
+void byteSwapInPlace(std::span<Type, Extent> data) noexcept {
+    byteSwapInPlace(data.data(), data.size());
+}
+
+/**
+ * @brief Copy a span, reversing the byte order of every element
+ * @param source Elements to convert
+ * @param destination Output; converts as many elements as both spans hold
+ */
+template <typename Type, size_t SourceExtent, size_t DestinationExtent>
+void byteSwapCopy(std::span<const Type, SourceExtent> source,
+                  std::span<Type, DestinationExtent> destination) noexcept {
+    byteSwapCopy(source.data(), destination.data(), std::min(source.size(), destination.size()));
+}
+
+/**
+ * @brief Convert a span in place between two byte orders
+ * @param data Elements to convert
+ * @param from_order Byte order of the data
+ * @param to_order Requested byte order
+ */
+template <typename Type, size_t Extent>
+void convertByteOrderInPlace(std::span<Type, Extent> data,
+                             ByteOrder from_order,
+                             ByteOrder to_order) noexcept {
+    convertByteOrderInPlace(data.data(), data.size(), from_order, to_order);
+}
+
+/**
+ * @brief Get a view of a span in another byte order
+ *
+ * When the orders match no data is touched and @p input itself is
+ * returned, so deserializing data that is already in native order costs
+ * nothing. Otherwise the elements are swapped into @p output and the
+ * converted part of @p output is returned. Read the result, not
+ * @p output, to benefit from the zero-copy case.
+ *
+ * @param input Elements in @p from_order
+ * @param output Buffer for converted elements; used only when swapping
+ * @param from_order Byte order of @p input
+ * @param to_order Requested byte order
+ * @return View of the elements in @p to_order; as long as @p input unless
+ *         @p output is shorter
+ *
+ * @example
+ * @code
+ * std::vector<uint32_t> scratch(column.size());
+ * std::span<const uint32_t> values = trlc::platform::convertByteOrder<uint32_t>(
+ *     column, scratch, ByteOrder::little_endian, trlc::platform::getByteOrder());
+ * @endcode
+ */
+template <typename Type>
+std::span<const Type> convertByteOrder(std::span<const Type> input,
+                                       std::span<Type> output,
+                                       ByteOrder from_order,
+                                       ByteOrder to_order) noexcept {
+    if (areByteOrdersCompatible(from_order, to_order)) {
+        return input;
+    }
+    const size_t count = std::min(input.size(), output.size());
+    byteSwapCopy(input.data(), output.data(), count);
+    return std::span<const Type>(output.data(), count);
+}
+
+#endif
+
+}  // namespace platform
+}  // namespace trlc
@@ -37,7 +37,10 @@
 #include "trlc/platform/endianness.hpp"
 #include "trlc/platform/features.hpp"
 #include "trlc/platform/macros.hpp"
+#include "trlc/platform/numa.hpp"
 #include "trlc/platform/platform.hpp"
+#include "trlc/platform/resources.hpp"
+#include "trlc/platform/topology.hpp"
 #include "trlc/platform/typeinfo.hpp"
 
 // Conditionally include debug utilities
@@ -121,12 +124,30 @@ struct PlatformReport {
     /// C++ standard information (version, feature support)
     CppStandardInfo cpp_standard;
 
-    /// Language and runtime feature availability
+    /// Language and runtime feature availability (runtime fields detected on this CPU)
     FeatureSet features;
 
     /// Endianness information (byte order, utilities)
     EndiannessInfo endianness;
 
+    /// x86-64 microarchitecture level of this CPU (none on other architectures)
+    X86Level x86_level;
+
+    /// Cache hierarchy detected at runtime (empty if unavailable)
+    CacheTopology caches;
+
+    /// Processor topology detected at runtime (cores, packages, NUMA nodes)
+    CpuTopology topology;
+
+    /// CPUs usable by this process under affinity and container limits
+    CpuBudget cpu_budget;
+
+    /// Memory limit under container limits, with the usage at the time it was cached
+    MemoryBudget memory_budget;
+
+    /// NUMA nodes and memory policy support
+    NumaInfo numa;
+
     /**
      * @brief Generate a human-readable platform report
      *
@@ -213,7 +234,68 @@ struct PlatformReport {
         ss << "  Cache Line Size:     " << architecture.cache_line_size << " bytes\n";
         ss << "  Unaligned Access:    " << (architecture.supportsUnalignedAccess() ? "Yes" : "No")
            << "\n";
-        ss << "  SIMD Support:        " << (hasSimdSupport() ? "Yes" : "No") << "\n\n";
+        ss << "  SIMD Support:        " << (hasSimdSupport() ? "Yes" : "No") << "\n";
+        ss << "  Hybrid Cores:        ";
+        if (topology.is_hybrid) {
+            ss << "Yes (" << topology.cpusOfType(CoreType::performance).size() << " performance, "
+               << topology.cpusOfType(CoreType::efficiency).size() << " efficiency CPUs)\n\n";
+        } else {
+            ss << "No\n\n";
+        }
+
+        // Cache Hierarchy (detected at runtime)
+        ss << "CACHE HIERARCHY:\n";
+        ss << std::string(20, '-') << "\n";
+        if (caches.isDetected()) {
+            for (const CacheInfo& cache : caches.caches) {
+                std::string label = "  " + cacheName(cache) + ":";
+                label.resize(23, ' ');
+                ss << label << cache.size_bytes / 1024 << " KiB, " << cache.line_size
+                   << " B lines";
+                if (cache.associativity != 0) {
+                    ss << ", " << cache.associativity << "-way";
+                }
+                if (cache.shared_cpu_count != 0) {
+                    ss << ", shared by " << cache.shared_cpu_count;
+                }
+                ss << "\n";
+            }
+        } else {
+            ss << "  Not available\n";
+        }
+        ss << "\n";
+
+        // Processor Topology (detected at runtime)
+        ss << "CPU TOPOLOGY:\n";
+        ss << std::string(20, '-') << "\n";
+        ss << "  Logical CPUs:        " << topology.logicalCpuCount() << "\n";
+        ss << "  Physical Cores:      " << topology.core_count << "\n";
+        ss << "  Packages:            " << topology.package_count << "\n";
+        ss << "  NUMA Nodes:          " << topology.node_count << "\n";
+        ss << "  NUMA Memory Nodes:   " << numa.nodeCount() << " (memory policy "
+           << (numa.policy_supported ? "available" : "unavailable") << ")\n";
+        ss << "  SMT:                 " << (topology.hasSmt() ? "Yes" : "No") << "\n\n";
+
+        // Resource Limits (affinity and container cgroups)
+        ss << "RESOURCE LIMITS:\n";
+        ss << std::string(20, '-') << "\n";
+        ss << "  Effective CPUs:      " << cpu_budget.effective_cpus << " of "
+           << cpu_budget.online_cpus << " online\n";
+        ss << "  Affinity Mask:       " << cpu_budget.affinity_cpus << " CPUs\n";
+        ss << "  CPU Quota:           ";
+        if (cpu_budget.quota_cpus > 0.0) {
+            ss << cpu_budget.quota_cpus << " CPUs (cgroup "
+               << cgroupVersionName(cpu_budget.cgroup_version) << ")\n";
+        } else {
+            ss << "None\n";
+        }
+        ss << "  Memory Limit:        " << (memory_budget.effective_bytes >> 20) << " MiB of "
+           << (memory_budget.physical_bytes >> 20) << " MiB physical";
+        if (memory_budget.isLimited()) {
+            ss << " (cgroup " << cgroupVersionName(memory_budget.cgroup_version) << ")";
+        }
+        ss << "\n";
+        ss << "  Memory Usage:        " << (memory_budget.usage_bytes >> 20) << " MiB\n\n";
 
         // C++ Standard Information
         ss << "C++ STANDARD INFORMATION:\n";
@@ -236,8 +318,23 @@ struct PlatformReport {
         ss << "  Atomic Operations:   " << (features.has_atomic ? "Yes" : "No") << "\n";
         ss << "  Inline Assembly:     " << (features.has_inline_asm ? "Yes" : "No") << "\n";
         ss << "  SSE Support:         " << (features.has_sse ? "Yes" : "No") << "\n";
+        ss << "  SSE2 Support:        " << (features.has_sse2 ? "Yes" : "No") << "\n";
+        ss << "  SSE4.2 Support:      " << (features.has_sse4_2 ? "Yes" : "No") << "\n";
         ss << "  AVX Support:         " << (features.has_avx ? "Yes" : "No") << "\n";
-        ss << "  NEON Support:        " << (features.has_neon ? "Yes" : "No") << "\n\n";
+        ss << "  AVX2 Support:        " << (features.has_avx2 ? "Yes" : "No") << "\n";
+        ss << "  AVX-512F Support:    " << (features.has_avx512f ? "Yes" : "No") << "\n";
+        ss << "  NEON Support:        " << (features.has_neon ? "Yes" : "No") << "\n";
+        ss << "  Hardware AES:        " << (features.has_hardware_aes ? "Yes" : "No") << "\n";
+        ss << "  Hardware Random:     " << (features.has_hardware_random ? "Yes" : "No") << "\n";
+        ss << "  ISA Extensions:     ";
+        for (int index = 0; index < RUNTIME_FEATURE_COUNT; ++index) {
+            const auto feature = static_cast<RuntimeFeature>(index);
+            if (features.hasRuntimeFeature(feature)) {
+                ss << " " << runtimeFeatureName(feature);
+            }
+        }
+        ss << "\n";
+        ss << "  x86-64 Level:        " << x86LevelName(x86_level) << "\n\n";
 
         // Endianness Information (using data from ArchitectureInfo)
         ss << "ENDIANNESS INFORMATION:\n";
@@ -321,7 +418,8 @@ struct PlatformReport {
  * all detection modules and is the primary interface for obtaining
  * complete platform information.
  *
- * @return PlatformReport structure containing all detected information
+ * @return PlatformReport structure containing all detected information;
+ *         runtime sections that cannot be read are left empty
  *
  * @note This function is constexpr where possible, but some runtime
  *       features may require initialization via initializePlatform()
@@ -335,14 +433,36 @@ struct PlatformReport {
  * @endcode
  */
 inline PlatformReport getPlatformReport() noexcept {
-    return PlatformReport{
-        getCompilerInfo(),
-        getPlatformInfo(),
-        getArchitectureInfo(),
-        getCppStandardInfo(),
-        getFeatureSet(),
-        getEndiannessInfo()  // Now available from endianness.hpp
-    };
+    PlatformReport report{getCompilerInfo(),
+                          getPlatformInfo(),
+                          getArchitectureInfo(),
+                          getCppStandardInfo(),
+                          getRuntimeFeatureSet(),
+                          getEndiannessInfo(),  // Now available from endianness.hpp
+                          getX86Level(),
+                          CacheTopology{},
+                          CpuTopology{{}, 0, 0, 0, false},
+                          CpuBudget{0, 0, 0, 0.0, CgroupVersion::none, 0},
+                          MemoryBudget{0, 0, 0, 0, CgroupVersion::none, 0},
+                          NumaInfo{{}, false}};
+
+    // The runtime sections read system files and copy containers; a section
+    // that cannot be gathered is left empty rather than failing the report
+    try {
+        report.caches = getCacheTopology();
+        report.topology = getCpuTopology();
+    } catch (...) {
+    }
+    try {
+        report.cpu_budget = getCpuBudget();
+        report.memory_budget = getMemoryBudget();
+    } catch (...) {
+    }
+    try {
+        report.numa = getNumaInfo();
+    } catch (...) {
+    }
+    return report;
 }
 
 //==============================================================================
@@ -399,11 +519,16 @@ inline void initializePlatform() noexcept {
     }
 
     try {
-        // Perform runtime feature detection initialization
-        // Most features are compile-time, but some CPU features need runtime detection
-
-        // Initialize any runtime feature detection here
-        // For now, most features are compile-time detected
+        // Populate the cached CPU feature bitmap so that later runtime
+        // feature queries never execute CPUID
+        static_cast<void>(detail::cpuFeatureBits());
+        static_cast<void>(getRuntimeFeatureSet());
+        static_cast<void>(getX86Level());
+        static_cast<void>(getCacheTopology());
+        static_cast<void>(getCpuTopology());
+        static_cast<void>(getEffectiveCpuCount());
+        static_cast<void>(getEffectiveMemoryLimit());
+        static_cast<void>(getNumaInfo());
 
         // Mark initialization complete
         detail::g_platform_initialized.store(true, std::memory_order_release);
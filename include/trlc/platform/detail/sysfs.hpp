@@ -0,0 +1,189 @@
+#pragma once
+
+/**
+ * @file sysfs.hpp
+ * @brief Internal helpers for reading Linux sysfs, procfs and cgroupfs files
+ *
+ * These files are small, single-value text files. The helpers read them with
+ * C stdio and report failure instead of throwing, so callers can fall back to
+ * other detection methods on systems where the files do not exist.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace trlc {
+namespace platform {
+namespace detail {
+
+/**
+ * @brief Read the first line of a text file
+ * @param path File path
+ * @param line Receives the line without the trailing newline
+ * @return true if the file could be opened and contained a line
+ */
+inline bool readFirstLine(const std::string& path, std::string& line) {
+    std::FILE* file = std::fopen(path.c_str(), "r");
+    if (file == nullptr) {
+        return false;
+    }
+
+    char buffer[4096];
+    const bool ok = std::fgets(buffer, sizeof(buffer), file) != nullptr;
+    std::fclose(file);
+    if (!ok) {
+        return false;
+    }
+
+    line = buffer;
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+        line.pop_back();
+    }
+    return true;
+}
+
+/**
+ * @brief Call a function for every line of a text file
+ * @param path File path
+ * @param callback Callable taking `const std::string&`; return false to stop
+ * @return true if the file could be opened
+ */
+template <typename Callback>
+bool forEachLine(const std::string& path, Callback&& callback) {
+    std::FILE* file = std::fopen(path.c_str(), "r");
+    if (file == nullptr) {
+        return false;
+    }
+
+    char buffer[4096];
+    std::string line;
+    while (std::fgets(buffer, sizeof(buffer), file) != nullptr) {
+        line = buffer;
+        while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+            line.pop_back();
+        }
+        if (!callback(line)) {
+            break;
+        }
+    }
+    std::fclose(file);
+    return true;
+}
+
+/**
+ * @brief Parse a decimal unsigned number, skipping leading whitespace
+ * @param text Text to parse
+ * @param value Receives the parsed number
+ * @param end Receives the index after the last digit (optional)
+ * @return true if at least one digit was parsed
+ */
+inline bool parseUnsigned(const std::string& text,
+                          uint64_t& value,
+                          size_t* end = nullptr) noexcept {
+    size_t pos = 0;
+    while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t')) {
+        ++pos;
+    }
+
+    const size_t first_digit = pos;
+    uint64_t result = 0;
+    while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+        result = result * 10 + static_cast<uint64_t>(text[pos] - '0');
+        ++pos;
+    }
+    if (pos == first_digit) {
+        return false;
+    }
+
+    value = result;
+    if (end != nullptr) {
+        *end = pos;
+    }
+    return true;
+}
+
+/**
+ * @brief Read a file containing a single decimal number
+ * @param path File path
+ * @param value Receives the number
+ * @return true if the file exists and starts with a number
+ */
+inline bool readUnsigned(const std::string& path, uint64_t& value) {
+    std::string line;
+    return readFirstLine(path, line) && parseUnsigned(line, value);
+}
+
+/**
+ * @brief Parse a size with an optional binary suffix, as used by sysfs
+ * @param text Text such as "48K", "2048K" or "32M"
+ * @return Size in bytes, or 0 if the text is not a size
+ */
+inline uint64_t parseSizeWithSuffix(const std::string& text) noexcept {
+    uint64_t value = 0;
+    size_t end = 0;
+    if (!parseUnsigned(text, value, &end)) {
+        return 0;
+    }
+
+    if (end < text.size()) {
+        switch (text[end]) {
+            case 'K':
+            case 'k':
+                return value << 10;
+            case 'M':
+            case 'm':
+                return value << 20;
+            case 'G':
+            case 'g':
+                return value << 30;
+            default:
+                break;
+        }
+    }
+    return value;
+}
+
+/**
+ * @brief Parse a kernel CPU or node list
+ * @param text List such as "0-3,8-11,16"
+ * @return IDs in the order listed; empty if the text is malformed
+ */
+inline std::vector<int> parseCpuList(const std::string& text) {
+    std::vector<int> ids;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        uint64_t first = 0;
+        size_t used = 0;
+        if (!parseUnsigned(text.substr(pos), first, &used)) {
+            break;
+        }
+        pos += used;
+
+        uint64_t last = first;
+        if (pos < text.size() && text[pos] == '-') {
+            ++pos;
+            if (!parseUnsigned(text.substr(pos), last, &used) || last < first) {
+                return {};
+            }
+            pos += used;
+        }
+        for (uint64_t id = first; id <= last; ++id) {
+            ids.push_back(static_cast<int>(id));
+        }
+
+        if (pos < text.size() && text[pos] == ',') {
+            ++pos;
+        } else {
+            break;
+        }
+    }
+    return ids;
+}
+
+}  // namespace detail
+}  // namespace platform
+}  // namespace trlc
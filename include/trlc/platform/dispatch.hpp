@@ -0,0 +1,227 @@
+#pragma once
+
+/**
+ * @file dispatch.hpp
+ * @brief Runtime selection of CPU-specific function implementations
+ *
+ * A Dispatch object is built from a list of implementations of the same
+ * function, each tagged with the runtime features it needs. The best
+ * implementation the CPU supports is chosen once, from the cached feature
+ * bitmap, and every later call goes through a plain function pointer with no
+ * feature checks on the hot path.
+ *
+ * @example
+ * @code
+ * static const Dispatch<size_t(const char*, size_t)> count_lines{
+ *     {countLinesAvx2, runtimeFeatureMask({RuntimeFeature::avx2}), "avx2"},
+ *     {countLinesSse42, runtimeFeatureMask({RuntimeFeature::sse4_2}), "sse4.2"},
+ *     {countLinesScalar, 0, "scalar"}};
+ *
+ * size_t lines = count_lines(buffer, size);
+ * @endcode
+ *
+ * For functions on hot paths TRLC_DISPATCH_FUNCTION defines an ordinary
+ * function whose target is chosen the same way. On ELF platforms with GNU
+ * indirect function support the dynamic loader binds the call directly to the
+ * selected implementation, so calls cost the same as any other call into a
+ * shared object.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+#include "trlc/platform/features.hpp"
+
+namespace trlc {
+namespace platform {
+
+/**
+ * @brief One implementation offered to a Dispatch
+ * @tparam Signature Function type, e.g. `int(const float*, size_t)`
+ */
+template <typename Signature>
+struct DispatchCandidate;
+
+template <typename Result, typename... Args>
+struct DispatchCandidate<Result(Args...)> {
+    Result (*function)(Args...);  ///< Implementation to call
+    uint64_t required_features;   ///< Bitmap from runtimeFeatureMask() or x86LevelFeatureMask()
+    const char* name;             ///< Name reported by Dispatch::name()
+};
+
+/**
+ * @brief Function pointer resolved once to the best supported implementation
+ *
+ * Candidates are listed best first; the first one whose required features
+ * are all available is selected when the Dispatch is constructed. The last
+ * candidate should have no requirements so that every CPU has a match.
+ *
+ * @tparam Signature Function type shared by all candidates
+ */
+template <typename Signature>
+class Dispatch;
+
+template <typename Result, typename... Args>
+class Dispatch<Result(Args...)> {
+public:
+    using FunctionPointer = Result (*)(Args...);
+    using Candidate = DispatchCandidate<Result(Args...)>;
+
+    /**
+     * @brief Resolve against the features of the running CPU
+     * @param candidates Implementations ordered from most to least preferred
+     */
+    Dispatch(std::initializer_list<Candidate> candidates) noexcept
+        : Dispatch(candidates, detail::cpuFeatureBits()) {}
+
+    /**
+     * @brief Resolve against an explicit feature bitmap
+     * @param candidates Implementations ordered from most to least preferred
+     * @param available_features Bitmap of features considered available
+     * @note Useful for testing every path, or for capping the selected
+     *       implementation below what the CPU supports
+     */
+    Dispatch(std::initializer_list<Candidate> candidates, uint64_t available_features) noexcept {
+        for (const Candidate& candidate : candidates) {
+            if ((available_features & candidate.required_features) ==
+                candidate.required_features) {
+                _function = candidate.function;
+                _name = candidate.name;
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Call the selected implementation
+     * @param args Arguments forwarded to the implementation
+     * @return Result of the implementation
+     * @note Calling a Dispatch without a selected implementation is undefined
+     */
+    Result operator()(Args... args) const {
+        return _function(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Get the selected implementation
+     * @return Function pointer, or nullptr if no candidate matched
+     */
+    FunctionPointer get() const noexcept { return _function; }
+
+    /**
+     * @brief Get the name of the selected implementation
+     * @return Candidate name, or "none" if no candidate matched
+     */
+    const char* name() const noexcept { return _name; }
+
+    /**
+     * @brief Check whether a candidate was selected
+     * @return true if the Dispatch can be called
+     */
+    explicit operator bool() const noexcept { return _function != nullptr; }
+
+private:
+    FunctionPointer _function = nullptr;
+    const char* _name = "none";
+};
+
+namespace detail {
+
+/**
+ * @brief Function pointer that resolves itself on the first call
+ *
+ * The pointer starts out at a stub which selects the implementation, stores
+ * it and forwards the call. It is constant-initialized, so it can be called
+ * from static initializers in any order.
+ *
+ * @tparam Signature Function type
+ * @tparam Resolver Type with a static `resolve()` returning the implementation
+ */
+template <typename Signature, typename Resolver>
+struct LazyDispatch;
+
+template <typename Result, typename... Args, typename Resolver>
+struct LazyDispatch<Result(Args...), Resolver> {
+    using FunctionPointer = Result (*)(Args...);
+
+    static Result resolveAndCall(Args... args) {
+        const FunctionPointer function = Resolver::resolve();
+        target.store(function, std::memory_order_relaxed);
+        return function(std::forward<Args>(args)...);
+    }
+
+    static inline std::atomic<FunctionPointer> target{&resolveAndCall};
+};
+
+}  // namespace detail
+
+}  // namespace platform
+}  // namespace trlc
+
+//
+// Dispatched function definitions
+//
+
+/**
+ * @brief Whether TRLC_DISPATCH_FUNCTION uses GNU indirect functions
+ *
+ * Set by the build system when the toolchain and loader support
+ * `__attribute__((ifunc))` (see cmake/CheckFeatures.cmake). Without it the
+ * macro falls back to a self-resolving cached function pointer.
+ */
+#ifndef TRLC_PLATFORM_HAS_IFUNC
+    #define TRLC_PLATFORM_HAS_IFUNC 0
+#endif
+
+/**
+ * @brief Define a function that forwards to the best supported implementation
+ *
+ * Use once per function, in a source file; other translation units declare
+ * the function normally. Candidates are listed best first, as for Dispatch.
+ *
+ * @param result Return type
+ * @param name Function name
+ * @param params Parenthesized parameter list, e.g. `(const char* data, size_t size)`
+ * @param args Parenthesized argument list forwarded to the implementation, e.g. `(data, size)`
+ * @param ... DispatchCandidate initializers
+ *
+ * @note With ifunc the selection runs while the dynamic loader applies
+ *       relocations, before static constructors and possibly before the
+ *       objects holding cached state are relocated. Resolvers therefore must
+ *       not read or write any cached or global state: this one executes
+ *       CPUID into a local bitmap with detail::detectCpuFeatureBits() and
+ *       selects from that alone. Resolver symbols are `extern "C"`, so
+ *       @p name must be unique across the program.
+ *
+ * @example
+ * @code
+ * TRLC_DISPATCH_FUNCTION(size_t, countLines, (const char* data, size_t size), (data, size),
+ *                        {countLinesAvx2, runtimeFeatureMask({RuntimeFeature::avx2}), "avx2"},
+ *                        {countLinesScalar, 0, "scalar"});
+ * @endcode
+ */
+#if TRLC_PLATFORM_HAS_IFUNC
+    #define TRLC_DISPATCH_FUNCTION(result, name, params, args, ...)                                \
+        extern "C" auto trlc_ifunc_resolve_##name()->result(*) params {                            \
+            const uint64_t features = ::trlc::platform::detail::detectCpuFeatureBits();            \
+            return ::trlc::platform::Dispatch<result params>({__VA_ARGS__}, features).get();       \
+        }                                                                                          \
+        result name params __attribute__((ifunc("trlc_ifunc_resolve_" #name)))
+#else
+    #define TRLC_DISPATCH_FUNCTION(result, name, params, args, ...)                                \
+        struct TrlcDispatchResolver_##name {                                                       \
+            static auto resolve() noexcept -> result(*) params {                                   \
+                return ::trlc::platform::Dispatch<result params>{__VA_ARGS__}.get();               \
+            }                                                                                      \
+        };                                                                                         \
+        result name params {                                                                       \
+            return ::trlc::platform::detail::LazyDispatch<result params,                           \
+                                                          TrlcDispatchResolver_##name>::target     \
+                .load(std::memory_order_relaxed) args;                                             \
+        }                                                                                          \
+        static_assert(true, "")
+#endif
@@ -0,0 +1,291 @@
+#pragma once
+
+/**
+ * @file endian_buffer.hpp
+ * @brief Endian-aware loads and stores at arbitrary offsets in byte buffers
+ *
+ * Wire formats and file headers put multi-byte fields at offsets that are
+ * rarely aligned and in a byte order that is often not the host's. The
+ * functions here read and write such a field in one call, e.g.
+ * `loadBE<uint32_t>(packet + 13)`. At run time they compile to a plain
+ * load or store plus a byte swap, which GCC and Clang fuse into MOVBE (or
+ * BSWAP) on x86 and LDR+REV on ARM. On architectures without unaligned
+ * access, and during constant evaluation, the value is assembled byte by
+ * byte instead.
+ *
+ * BigEndian<T> and LittleEndian<T> wrap the same conversions in a field
+ * type, so structs laid over wire data convert on every access by
+ * construction.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "trlc/platform/architecture.hpp"
+#include "trlc/platform/endianness.hpp"
+#include "trlc/platform/macros.hpp"
+
+namespace trlc {
+namespace platform {
+
+namespace detail {
+
+/**
+ * @brief Check whether the caller is being evaluated as a constant expression
+ * @return true during constant evaluation; always true when the compiler
+ *         cannot tell, which selects the portable path everywhere
+ */
+constexpr bool isConstantEvaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#elif TRLC_HAS_BUILTIN(__builtin_is_constant_evaluated)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief Validate the value and byte types of a buffer access
+ * @tparam Type Value type
+ * @tparam Byte Buffer element type
+ */
+template <typename Type, typename Byte>
+constexpr void checkBufferAccess() noexcept {
+    static_assert(isByteSwappable<Type>() && !std::is_same_v<Type, bool>,
+                  "Buffer loads and stores support integers, float, double and enumerations");
+    static_assert(std::is_same_v<Byte, std::byte> || std::is_same_v<Byte, unsigned char> ||
+                      std::is_same_v<Byte, char>,
+                  "Buffers must be std::byte, unsigned char or char");
+}
+
+/**
+ * @brief Assemble a value from bytes one at a time
+ * @param bytes First byte of the field
+ * @param big_endian true if the most significant byte comes first
+ * @return Value in host representation
+ */
+template <typename Type, typename Byte>
+constexpr Type loadBytes(const Byte* bytes, bool big_endian) noexcept {
+    using Unsigned = UnsignedBits<sizeof(Type)>;
+    Unsigned value = 0;
+    for (size_t i = 0; i < sizeof(Type); ++i) {
+        const size_t shift = 8 * (big_endian ? sizeof(Type) - 1 - i : i);
+        value = static_cast<Unsigned>(
+            value | static_cast<Unsigned>(static_cast<Unsigned>(static_cast<uint8_t>(bytes[i]))
+                                          << shift));
+    }
+    return fromUnsignedBits<Type>(value);
+}
+
+/**
+ * @brief Write a value one byte at a time
+ * @param bytes First byte of the field
+ * @param value Value in host representation
+ * @param big_endian true if the most significant byte comes first
+ */
+template <typename Type, typename Byte>
+constexpr void storeBytes(Byte* bytes, Type value, bool big_endian) noexcept {
+    const auto bits = toUnsignedBits(value);
+    for (size_t i = 0; i < sizeof(Type); ++i) {
+        const size_t shift = 8 * (big_endian ? sizeof(Type) - 1 - i : i);
+        bytes[i] = static_cast<Byte>(static_cast<uint8_t>(bits >> shift));
+    }
+}
+
+/**
+ * @brief Load a field stored in @p order
+ * @param bytes First byte of the field; no alignment required
+ * @param order ByteOrder::big_endian or ByteOrder::little_endian
+ * @return Value in host representation
+ */
+template <typename Type, typename Byte>
+constexpr Type loadWithOrder(const Byte* bytes, ByteOrder order) noexcept {
+    checkBufferAccess<Type, Byte>();
+    constexpr bool word_access = getArchitectureInfo().supportsUnalignedAccess() &&
+                                 (isLittleEndian() || isBigEndian());
+    if constexpr (word_access) {
+        if (!isConstantEvaluated()) {
+            // Swap as an integer: a float in wire order may be a signalling
+            // NaN that x87 loads would quiet before it is swapped back
+            UnsignedBits<sizeof(Type)> bits{};
+            std::memcpy(&bits, bytes, sizeof(Type));
+            return fromUnsignedBits<Type>(convertByteOrder(bits, order, getByteOrder()));
+        }
+    }
+    return loadBytes<Type>(bytes, order == ByteOrder::big_endian);
+}
+
+/**
+ * @brief Store a field in @p order
+ * @param bytes First byte of the field; no alignment required
+ * @param value Value in host representation
+ * @param order ByteOrder::big_endian or ByteOrder::little_endian
+ */
+template <typename Type, typename Byte>
+constexpr void storeWithOrder(Byte* bytes, Type value, ByteOrder order) noexcept {
+    checkBufferAccess<Type, Byte>();
+    constexpr bool word_access = getArchitectureInfo().supportsUnalignedAccess() &&
+                                 (isLittleEndian() || isBigEndian());
+    if constexpr (word_access) {
+        if (!isConstantEvaluated()) {
+            const auto bits = convertByteOrder(toUnsignedBits(value), getByteOrder(), order);
+            std::memcpy(bytes, &bits, sizeof(Type));
+            return;
+        }
+    }
+    storeBytes(bytes, value, order == ByteOrder::big_endian);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Load a big-endian (network order) field from a byte buffer
+ *
+ * @tparam Type Integer, float, double or enumeration type
+ * @param bytes First byte of the field; no alignment required
+ * @return Value in host byte order
+ *
+ * @example
+ * @code
+ * const std::byte* packet = ...;
+ * auto length = trlc::platform::loadBE<uint32_t>(packet + 13);
+ * @endcode
+ */
+template <typename Type, typename Byte>
+constexpr Type loadBE(const Byte* bytes) noexcept {
+    return detail::loadWithOrder<Type>(bytes, ByteOrder::big_endian);
+}
+
+/**
+ * @brief Load a little-endian field from a byte buffer
+ *
+ * @tparam Type Integer, float, double or enumeration type
+ * @param bytes First byte of the field; no alignment required
+ * @return Value in host byte order
+ */
+template <typename Type, typename Byte>
+constexpr Type loadLE(const Byte* bytes) noexcept {
+    return detail::loadWithOrder<Type>(bytes, ByteOrder::little_endian);
+}
+
+/**
+ * @brief Store a field in big-endian (network) order into a byte buffer
+ *
+ * @tparam Type Integer, float, double or enumeration type
+ * @param bytes First byte of the field; no alignment required
+ * @param value Value in host byte order
+ */
+template <typename Type, typename Byte>
+constexpr void storeBE(Byte* bytes, Type value) noexcept {
+    detail::storeWithOrder(bytes, value, ByteOrder::big_endian);
+}
+
+/**
+ * @brief Store a field in little-endian order into a byte buffer
+ *
+ * @tparam Type Integer, float, double or enumeration type
+ * @param bytes First byte of the field; no alignment required
+ * @param value Value in host byte order
+ */
+template <typename Type, typename Byte>
+constexpr void storeLE(Byte* bytes, Type value) noexcept {
+    detail::storeWithOrder(bytes, value, ByteOrder::little_endian);
+}
+
+/**
+ * @brief Value stored in a fixed byte order
+ *
+ * Has the size of @p Type, is trivially copyable and standard-layout, so
+ * it can be a field of a struct laid over a network buffer or a mapped
+ * file. Reading converts to host order and assigning converts back; the
+ * conversion cannot be forgotten and no separate decode pass is needed.
+ * Use BigEndian/LittleEndian, or their Unaligned variants for packed
+ * layouts where fields do not sit on their natural alignment.
+ *
+ * @tparam Type Integer, float, double or enumeration type
+ * @tparam Order ByteOrder::big_endian or ByteOrder::little_endian
+ * @tparam Alignment alignof(Type), or 1 for packed layouts
+ *
+ * @example
+ * @code
+ * struct PacketHeader {
+ *     uint8_t type;
+ *     trlc::platform::UnalignedBigEndian<uint32_t> length;
+ *     trlc::platform::UnalignedBigEndian<uint64_t> sequence;
+ * };
+ * static_assert(sizeof(PacketHeader) == 13);
+ *
+ * const auto* header = reinterpret_cast<const PacketHeader*>(packet);
+ * if (header->length > max_length) { ... }
+ * @endcode
+ */
+template <typename Type, ByteOrder Order, size_t Alignment = alignof(Type)>
+class EndianValue {
+    static_assert(Order == ByteOrder::big_endian || Order == ByteOrder::little_endian,
+                  "EndianValue needs big- or little-endian storage");
+    static_assert(Alignment == 1 || Alignment == alignof(Type),
+                  "EndianValue alignment must be 1 or the natural alignment of the type");
+
+public:
+    using value_type = Type;
+
+    /// Byte order of the stored representation
+    static constexpr ByteOrder byte_order = Order;
+
+    /// Leaves the storage uninitialized, like the underlying integer
+    EndianValue() noexcept = default;
+
+    /**
+     * @brief Store a value
+     * @param value Value in host byte order
+     */
+    constexpr EndianValue(Type value) noexcept : _bytes{} {
+        detail::storeWithOrder(_bytes, value, Order);
+    }
+
+    /**
+     * @brief Replace the stored value
+     * @param value Value in host byte order
+     * @return *this
+     */
+    constexpr EndianValue& operator=(Type value) noexcept {
+        detail::storeWithOrder(_bytes, value, Order);
+        return *this;
+    }
+
+    /// @return Stored value in host byte order
+    constexpr Type value() const noexcept { return detail::loadWithOrder<Type>(_bytes, Order); }
+
+    /// Implicit conversion, so fields read like the plain integer
+    constexpr operator Type() const noexcept { return value(); }
+
+    /// @return Stored bytes, in @p Order
+    constexpr const std::byte* bytes() const noexcept { return _bytes; }
+
+private:
+    alignas(Alignment) std::byte _bytes[sizeof(Type)];
+};
+
+/// Big-endian (network order) value with natural alignment
+template <typename Type>
+using BigEndian = EndianValue<Type, ByteOrder::big_endian>;
+
+/// Little-endian value with natural alignment
+template <typename Type>
+using LittleEndian = EndianValue<Type, ByteOrder::little_endian>;
+
+/// Big-endian (network order) value that may sit at any offset in a packed struct
+template <typename Type>
+using UnalignedBigEndian = EndianValue<Type, ByteOrder::big_endian, 1>;
+
+/// Little-endian value that may sit at any offset in a packed struct
+template <typename Type>
+using UnalignedLittleEndian = EndianValue<Type, ByteOrder::little_endian, 1>;
+
+}  // namespace platform
+}  // namespace trlc
@@ -12,7 +12,8 @@
  * - Compile-time endianness detection with runtime fallbacks
  * - Efficient byte swapping using compiler intrinsics
  * - Network/host byte order conversion functions
- * - Template-based generic byte manipulation utilities
+ * - Template-based generic byte manipulation utilities for integers,
+ *   floating point values, enumerations and 128-bit integers
  * - Comprehensive macro interface for easy usage
  *
  * @author TRLC Platform Team
@@ -20,8 +21,44 @@
  */
 
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
 
+#if defined(__has_include)
+    #if __has_include(<bit>)
+        #include <bit>
+    #endif
+#endif
+
+/**
+ * @brief Whether the compiler provides 128-bit integers
+ *
+ * Set to 1 when __int128 and unsigned __int128 exist (GCC and Clang on
+ * 64-bit targets); byteSwap() and the conversions accept them then.
+ */
+#if defined(__SIZEOF_INT128__)
+    #define TRLC_HAS_INT128 1
+#else
+    #define TRLC_HAS_INT128 0
+#endif
+
+/**
+ * @brief Whether float and double can be byte swapped in constant expressions
+ *
+ * Requires std::bit_cast or the compiler builtin behind it.
+ */
+#if defined(__cpp_lib_bit_cast)
+    #define TRLC_HAS_CONSTEXPR_BIT_CAST 1
+#elif defined(__has_builtin)
+    #if __has_builtin(__builtin_bit_cast)
+        #define TRLC_HAS_CONSTEXPR_BIT_CAST 1
+    #else
+        #define TRLC_HAS_CONSTEXPR_BIT_CAST 0
+    #endif
+#else
+    #define TRLC_HAS_CONSTEXPR_BIT_CAST 0
+#endif
+
 namespace trlc {
 namespace platform {
 
@@ -275,6 +312,143 @@ constexpr uint64_t byteSwap64Impl(uint64_t value) noexcept {
 #endif
 }
 
+#if TRLC_HAS_INT128
+__extension__ typedef __int128 Int128;
+__extension__ typedef unsigned __int128 Uint128;
+
+/**
+ * @brief 128-bit byte swap implementation
+ */
+constexpr Uint128 byteSwap128Impl(Uint128 value) noexcept {
+    #if defined(__has_builtin)
+        #if __has_builtin(__builtin_bswap128)
+    return __builtin_bswap128(value);
+        #else
+    return (static_cast<Uint128>(byteSwap64Impl(static_cast<uint64_t>(value))) << 64) |
+           byteSwap64Impl(static_cast<uint64_t>(value >> 64));
+        #endif
+    #else
+    return (static_cast<Uint128>(byteSwap64Impl(static_cast<uint64_t>(value))) << 64) |
+           byteSwap64Impl(static_cast<uint64_t>(value >> 64));
+    #endif
+}
+#endif
+
+/// Unsigned integer of @p Size bytes; void if there is none
+template <size_t Size>
+struct UnsignedBitsOf {
+    using type = void;
+};
+template <>
+struct UnsignedBitsOf<1> {
+    using type = uint8_t;
+};
+template <>
+struct UnsignedBitsOf<2> {
+    using type = uint16_t;
+};
+template <>
+struct UnsignedBitsOf<4> {
+    using type = uint32_t;
+};
+template <>
+struct UnsignedBitsOf<8> {
+    using type = uint64_t;
+};
+#if TRLC_HAS_INT128
+template <>
+struct UnsignedBitsOf<16> {
+    using type = Uint128;
+};
+#endif
+
+template <size_t Size>
+using UnsignedBits = typename UnsignedBitsOf<Size>::type;
+
+/**
+ * @brief Check whether a type is a 128-bit integer
+ *
+ * std::is_integral does not report __int128 in strict ISO mode, so it is
+ * recognized explicitly.
+ */
+template <typename Type>
+constexpr bool isInt128() noexcept {
+#if TRLC_HAS_INT128
+    return std::is_same_v<std::remove_cv_t<Type>, Int128> ||
+           std::is_same_v<std::remove_cv_t<Type>, Uint128>;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Check whether byteSwap() and the byte order conversions accept a type
+ *
+ * Accepted are integers up to 64 bits, 128-bit integers where available,
+ * float and double, and enumerations whose underlying type is accepted.
+ */
+template <typename Type>
+constexpr bool isByteSwappable() noexcept {
+    if constexpr (std::is_enum_v<Type>) {
+        return isByteSwappable<std::underlying_type_t<Type>>();
+    } else if constexpr (std::is_floating_point_v<Type>) {
+        return sizeof(Type) == 4 || sizeof(Type) == 8;
+    } else {
+        return (std::is_integral_v<Type> && sizeof(Type) <= 8) || isInt128<Type>();
+    }
+}
+
+/**
+ * @brief Reinterpret the bits of a value as another type of the same size
+ *
+ * constexpr where TRLC_HAS_CONSTEXPR_BIT_CAST is set.
+ */
+template <typename To, typename From>
+constexpr To bitCast(const From& from) noexcept {
+    static_assert(sizeof(To) == sizeof(From), "bitCast needs types of equal size");
+#if defined(__cpp_lib_bit_cast)
+    return std::bit_cast<To>(from);
+#elif TRLC_HAS_CONSTEXPR_BIT_CAST
+    return __builtin_bit_cast(To, from);
+#else
+    To to{};
+    std::memcpy(&to, &from, sizeof(To));
+    return to;
+#endif
+}
+
+/**
+ * @brief Get the object representation of a value as an unsigned integer
+ * @param value Integer, floating point or enumeration value
+ * @return Unsigned integer of the same size holding the same bits
+ */
+template <typename Type>
+constexpr UnsignedBits<sizeof(Type)> toUnsignedBits(Type value) noexcept {
+    if constexpr (std::is_enum_v<Type>) {
+        return toUnsignedBits(static_cast<std::underlying_type_t<Type>>(value));
+    } else if constexpr (std::is_floating_point_v<Type>) {
+        return bitCast<UnsignedBits<sizeof(Type)>>(value);
+    } else {
+        return static_cast<UnsignedBits<sizeof(Type)>>(value);
+    }
+}
+
+/**
+ * @brief Rebuild a value from the bits returned by toUnsignedBits()
+ * @param bits Object representation
+ * @return Value of type @p Type
+ */
+template <typename Type>
+constexpr Type fromUnsignedBits(UnsignedBits<sizeof(Type)> bits) noexcept {
+    if constexpr (std::is_enum_v<Type>) {
+        return static_cast<Type>(fromUnsignedBits<std::underlying_type_t<Type>>(bits));
+    } else if constexpr (std::is_floating_point_v<Type>) {
+        return bitCast<Type>(bits);
+    } else {
+        return static_cast<Type>(bits);
+    }
+}
+
 }  // namespace detail
 
 /**
@@ -308,20 +482,31 @@ constexpr uint64_t byteSwap64(uint64_t value) noexcept {
 }
 
 /**
- * @brief Generic byte swap function for integral types
+ * @brief Generic byte swap function
  *
  * Automatically selects the appropriate byte swap implementation based
- * on the size of the type. Supports signed and unsigned integral types.
- *
- * @tparam Type Integral type to byte swap
+ * on the size of the type. Supports signed and unsigned integral types up
+ * to 64 bits, 128-bit integers where TRLC_HAS_INT128 is set, float and
+ * double, and enumerations. Floating point values are swapped through
+ * their bit pattern; a swapped value is only meaningful as storage and
+ * may not be a valid number until it is swapped back. On x87 a swapped
+ * value that forms a signalling NaN is quieted in transit, so use loadBE()
+ * and storeBE() from endian_buffer.hpp for floating point wire fields.
+ *
+ * @tparam Type Type to byte swap
  * @param value Value to byte swap
  * @return Byte-swapped value
  */
 template <typename Type>
 constexpr Type byteSwap(Type value) noexcept {
-    static_assert(std::is_integral_v<Type>, "byteSwap only supports integral types");
-
-    if constexpr (sizeof(Type) == 1) {
+    static_assert(detail::isByteSwappable<Type>(),
+                  "byteSwap supports integers, float, double and enumerations");
+
+    if constexpr (std::is_enum_v<Type> || std::is_floating_point_v<Type>) {
+        // Swap the bit pattern as an unsigned integer of the same size
+        using Bits = detail::UnsignedBits<sizeof(Type)>;
+        return detail::fromUnsignedBits<Type>(byteSwap<Bits>(detail::toUnsignedBits(value)));
+    } else if constexpr (sizeof(Type) == 1) {
         // Single byte - no swapping needed
         return value;
     } else if constexpr (sizeof(Type) == 2) {
@@ -343,8 +528,12 @@ constexpr Type byteSwap(Type value) noexcept {
         auto swapped = byteSwap64(static_cast<uint64_t>(unsigned_value));
         return static_cast<Type>(swapped);
     } else {
-        static_assert(sizeof(Type) <= 8, "byteSwap supports types up to 64 bits");
+#if TRLC_HAS_INT128
+        // 128-bit integers
+        return static_cast<Type>(detail::byteSwap128Impl(static_cast<detail::Uint128>(value)));
+#else
         return value;  // Should never reach here
+#endif
     }
 }
 
@@ -358,13 +547,14 @@ constexpr Type byteSwap(Type value) noexcept {
  * Network byte order is defined as big-endian. This function converts
  * values from the host's native byte order to network byte order.
  *
- * @tparam Type Integral type to convert
+ * @tparam Type Integer, float, double or enumeration type to convert
  * @param value Value in host byte order
  * @return Value in network byte order (big-endian)
  */
 template <typename Type>
 constexpr Type hostToNetwork(Type value) noexcept {
-    static_assert(std::is_integral_v<Type>, "hostToNetwork only supports integral types");
+    static_assert(detail::isByteSwappable<Type>(),
+                  "hostToNetwork supports integers, float, double and enumerations");
 
     if constexpr (isLittleEndian()) {
         // Host is little-endian, need to swap to big-endian
@@ -381,13 +571,14 @@ constexpr Type hostToNetwork(Type value) noexcept {
  * Network byte order is defined as big-endian. This function converts
  * values from network byte order to the host's native byte order.
  *
- * @tparam Type Integral type to convert
+ * @tparam Type Integer, float, double or enumeration type to convert
  * @param value Value in network byte order (big-endian)
  * @return Value in host byte order
  */
 template <typename Type>
 constexpr Type networkToHost(Type value) noexcept {
-    static_assert(std::is_integral_v<Type>, "networkToHost only supports integral types");
+    static_assert(detail::isByteSwappable<Type>(),
+                  "networkToHost supports integers, float, double and enumerations");
 
     if constexpr (isLittleEndian()) {
         // Host is little-endian, need to swap from big-endian
@@ -489,7 +680,7 @@ constexpr ByteOrder getOppositeByteOrder(ByteOrder order) noexcept {
 /**
  * @brief Convert value between specified byte orders
  *
- * @tparam Type Integral type to convert
+ * @tparam Type Integer, float, double or enumeration type to convert
  * @param value Value to convert
  * @param from_order Source byte order
  * @param to_order Target byte order
@@ -497,7 +688,8 @@ constexpr ByteOrder getOppositeByteOrder(ByteOrder order) noexcept {
  */
 template <typename Type>
 constexpr Type convertByteOrder(Type value, ByteOrder from_order, ByteOrder to_order) noexcept {
-    static_assert(std::is_integral_v<Type>, "convertByteOrder only supports integral types");
+    static_assert(detail::isByteSwappable<Type>(),
+                  "convertByteOrder supports integers, float, double and enumerations");
 
     if (areByteOrdersCompatible(from_order, to_order)) {
         return value;
@@ -12,7 +12,9 @@
  * @copyright Copyright (c) 2025 TRLC Platform
  */
 
+#include <atomic>
 #include <cstdint>
+#include <initializer_list>
 
 // Include intrinsics headers for CPU feature detection
 #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
@@ -27,10 +29,17 @@
     #define TRLC_HAS_X86_INTRINSICS 0
 #endif
 
+#if TRLC_HAS_X86_INTRINSICS && defined(__APPLE__)
+    #include <sys/sysctl.h>  // AVX-512 state is enabled lazily on macOS
+#endif
+
 #if defined(__ARM_NEON) || defined(__aarch64__)
     #if defined(__GNUC__) || defined(__clang__)
         #include <arm_neon.h>
     #endif
+    #if defined(__aarch64__) && defined(__linux__)
+        #include <sys/auxv.h>  // getauxval(AT_HWCAP) runtime detection
+    #endif
     #define TRLC_HAS_ARM_INTRINSICS 1
 #else
     #define TRLC_HAS_ARM_INTRINSICS 0
@@ -68,19 +77,54 @@ enum class LanguageFeature : int {
  * and may not be detectable at compile time.
  */
 enum class RuntimeFeature : int {
-    sse = 0,         ///< SSE (Streaming SIMD Extensions)
-    sse2,            ///< SSE2 extensions
-    sse3,            ///< SSE3 extensions
-    sse4_1,          ///< SSE4.1 extensions
-    sse4_2,          ///< SSE4.2 extensions
-    avx,             ///< AVX (Advanced Vector Extensions)
-    avx2,            ///< AVX2 extensions
-    avx512f,         ///< AVX-512 Foundation
-    neon,            ///< ARM NEON SIMD extensions
-    hardware_aes,    ///< Hardware AES acceleration
-    hardware_random  ///< Hardware random number generation
+    sse = 0,          ///< SSE (Streaming SIMD Extensions)
+    sse2,             ///< SSE2 extensions
+    sse3,             ///< SSE3 extensions
+    sse4_1,           ///< SSE4.1 extensions
+    sse4_2,           ///< SSE4.2 extensions
+    avx,              ///< AVX (Advanced Vector Extensions)
+    avx2,             ///< AVX2 extensions
+    avx512f,          ///< AVX-512 Foundation
+    neon,             ///< ARM NEON SIMD extensions
+    hardware_aes,     ///< Hardware AES acceleration
+    hardware_random,  ///< Hardware random number generation
+    popcnt,           ///< POPCNT population count instruction
+    lzcnt,            ///< LZCNT leading zero count instruction
+    bmi1,             ///< BMI1 bit manipulation instructions
+    bmi2,             ///< BMI2 bit manipulation instructions
+    fma,              ///< FMA3 fused multiply-add
+    f16c,             ///< F16C half-precision conversion
+    pclmulqdq,        ///< PCLMULQDQ carry-less multiplication
+    sha,              ///< SHA hash acceleration (x86 SHA-NI, ARM SHA2)
+    vaes,             ///< VAES vector AES instructions
+    vpclmulqdq,       ///< VPCLMULQDQ vector carry-less multiplication
+    avx512bw,         ///< AVX-512 Byte and Word
+    avx512dq,         ///< AVX-512 Doubleword and Quadword
+    avx512vl,         ///< AVX-512 Vector Length extensions
+    avx512vnni,       ///< AVX-512 Vector Neural Network Instructions
+    avx512vbmi,       ///< AVX-512 Vector Byte Manipulation Instructions
+    avx_vnni,         ///< AVX (VEX-encoded) Vector Neural Network Instructions
+    rdseed,           ///< RDSEED hardware entropy source
+    movbe,            ///< MOVBE byte-swapping move
+    erms,             ///< Enhanced REP MOVSB/STOSB
+    fsrm,             ///< Fast Short REP MOVSB
+    amx_tile,         ///< AMX tile architecture
+    amx_int8,         ///< AMX 8-bit integer tile operations
+    amx_bf16,         ///< AMX bfloat16 tile operations
+    sve,              ///< ARM Scalable Vector Extension
+    sve2,             ///< ARM Scalable Vector Extension 2
+    crc32,            ///< ARM CRC32 instructions
+    dotprod,          ///< ARM dot product instructions
+    lse_atomics,      ///< ARM Large System Extensions atomics
+    ssse3,            ///< Supplemental SSE3 extensions
+    cx16,             ///< CMPXCHG16B 16-byte compare-and-swap
+    lahf_sahf,        ///< LAHF/SAHF in 64-bit mode
+    avx512cd          ///< AVX-512 Conflict Detection
 };
 
+/// Number of RuntimeFeature enumerators
+constexpr int RUNTIME_FEATURE_COUNT = static_cast<int>(RuntimeFeature::avx512cd) + 1;
+
 /**
  * @brief Feature detection structure
  *
@@ -114,6 +158,38 @@ struct FeatureSet {
     bool has_neon;             ///< ARM NEON support
     bool has_hardware_aes;     ///< Hardware AES support
     bool has_hardware_random;  ///< Hardware RNG support
+    bool has_popcnt;           ///< POPCNT support
+    bool has_lzcnt;            ///< LZCNT support
+    bool has_bmi1;             ///< BMI1 support
+    bool has_bmi2;             ///< BMI2 support
+    bool has_fma;              ///< FMA support
+    bool has_f16c;             ///< F16C support
+    bool has_pclmulqdq;        ///< PCLMULQDQ support
+    bool has_sha;              ///< SHA support
+    bool has_vaes;             ///< VAES support
+    bool has_vpclmulqdq;       ///< VPCLMULQDQ support
+    bool has_avx512bw;         ///< AVX-512BW support
+    bool has_avx512dq;         ///< AVX-512DQ support
+    bool has_avx512vl;         ///< AVX-512VL support
+    bool has_avx512vnni;       ///< AVX-512 VNNI support
+    bool has_avx512vbmi;       ///< AVX-512 VBMI support
+    bool has_avx_vnni;         ///< AVX-VNNI support
+    bool has_rdseed;           ///< RDSEED support
+    bool has_movbe;            ///< MOVBE support
+    bool has_erms;             ///< ERMS support
+    bool has_fsrm;             ///< FSRM support
+    bool has_amx_tile;         ///< AMX-TILE support
+    bool has_amx_int8;         ///< AMX-INT8 support
+    bool has_amx_bf16;         ///< AMX-BF16 support
+    bool has_sve;              ///< SVE support
+    bool has_sve2;             ///< SVE2 support
+    bool has_crc32;            ///< CRC32 support
+    bool has_dotprod;          ///< DotProd support
+    bool has_lse_atomics;      ///< LSE atomics support
+    bool has_ssse3;            ///< SSSE3 support
+    bool has_cx16;             ///< CMPXCHG16B support
+    bool has_lahf_sahf;        ///< LAHF-SAHF support
+    bool has_avx512cd;         ///< AVX-512CD support
 
     /**
      * @brief Checks if a specific language feature is available
@@ -179,6 +255,70 @@ struct FeatureSet {
                 return has_hardware_aes;
             case RuntimeFeature::hardware_random:
                 return has_hardware_random;
+            case RuntimeFeature::popcnt:
+                return has_popcnt;
+            case RuntimeFeature::lzcnt:
+                return has_lzcnt;
+            case RuntimeFeature::bmi1:
+                return has_bmi1;
+            case RuntimeFeature::bmi2:
+                return has_bmi2;
+            case RuntimeFeature::fma:
+                return has_fma;
+            case RuntimeFeature::f16c:
+                return has_f16c;
+            case RuntimeFeature::pclmulqdq:
+                return has_pclmulqdq;
+            case RuntimeFeature::sha:
+                return has_sha;
+            case RuntimeFeature::vaes:
+                return has_vaes;
+            case RuntimeFeature::vpclmulqdq:
+                return has_vpclmulqdq;
+            case RuntimeFeature::avx512bw:
+                return has_avx512bw;
+            case RuntimeFeature::avx512dq:
+                return has_avx512dq;
+            case RuntimeFeature::avx512vl:
+                return has_avx512vl;
+            case RuntimeFeature::avx512vnni:
+                return has_avx512vnni;
+            case RuntimeFeature::avx512vbmi:
+                return has_avx512vbmi;
+            case RuntimeFeature::avx_vnni:
+                return has_avx_vnni;
+            case RuntimeFeature::rdseed:
+                return has_rdseed;
+            case RuntimeFeature::movbe:
+                return has_movbe;
+            case RuntimeFeature::erms:
+                return has_erms;
+            case RuntimeFeature::fsrm:
+                return has_fsrm;
+            case RuntimeFeature::amx_tile:
+                return has_amx_tile;
+            case RuntimeFeature::amx_int8:
+                return has_amx_int8;
+            case RuntimeFeature::amx_bf16:
+                return has_amx_bf16;
+            case RuntimeFeature::sve:
+                return has_sve;
+            case RuntimeFeature::sve2:
+                return has_sve2;
+            case RuntimeFeature::crc32:
+                return has_crc32;
+            case RuntimeFeature::dotprod:
+                return has_dotprod;
+            case RuntimeFeature::lse_atomics:
+                return has_lse_atomics;
+            case RuntimeFeature::ssse3:
+                return has_ssse3;
+            case RuntimeFeature::cx16:
+                return has_cx16;
+            case RuntimeFeature::lahf_sahf:
+                return has_lahf_sahf;
+            case RuntimeFeature::avx512cd:
+                return has_avx512cd;
             default:
                 return false;
         }
@@ -397,20 +537,307 @@ inline bool checkCpuFeature(uint32_t leaf, uint32_t subleaf, int reg, int bit) n
     return (regs[reg] & (1u << bit)) != 0;
 }
 
+/// XCR0 bits for SSE (XMM) and AVX (upper YMM) register state
+constexpr uint64_t XCR0_AVX_STATE = (uint64_t{1} << 1) | (uint64_t{1} << 2);
+
+/// XCR0 bits for AVX-512 opmask, ZMM_Hi256 and Hi16_ZMM register state
+constexpr uint64_t XCR0_AVX512_STATE = (uint64_t{1} << 5) | (uint64_t{1} << 6) | (uint64_t{1} << 7);
+
+/// XCR0 bits for AMX tile configuration and tile data register state
+constexpr uint64_t XCR0_AMX_STATE = (uint64_t{1} << 17) | (uint64_t{1} << 18);
+
+/**
+ * @brief Read an extended control register
+ * @param index XCR index (0 = XCR0, the OS-enabled state components)
+ * @return Register value
+ * @note Only valid when CPUID reports OSXSAVE (leaf 1, ECX bit 27)
+ */
+inline uint64_t xgetbv(uint32_t index) noexcept {
+    #if defined(_MSC_VER)
+    return _xgetbv(index);
+    #elif defined(__GNUC__) || defined(__clang__)
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+    #else
+    static_cast<void>(index);
+    return 0;
+    #endif
+}
+
+/**
+ * @brief Check whether the OS enabled AVX-512 register state
+ *
+ * macOS enables AVX-512 state lazily on first use, so XCR0 does not show it
+ * up front; the kernel reports support through sysctl instead.
+ *
+ * @param xcr0 Value of XCR0
+ * @return true if AVX-512 instructions can be executed safely
+ */
+inline bool isOsAvx512Enabled(uint64_t xcr0) noexcept {
+    if ((xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE) {
+        return true;
+    }
+    #if defined(__APPLE__)
+    int enabled = 0;
+    size_t size = sizeof(enabled);
+    return sysctlbyname("hw.optional.avx512f", &enabled, &size, nullptr, 0) == 0 && enabled != 0;
+    #else
+    return false;
+    #endif
+}
+
 }  // namespace detail
 
 #endif  // TRLC_HAS_X86_INTRINSICS
 
+namespace detail {
+
+/// Marker bit showing that the cached CPU feature bitmap has been populated
+constexpr uint64_t CPU_FEATURES_VALID_BIT = uint64_t{1} << 63;
+
+/**
+ * @brief Get the bitmap mask for a runtime feature
+ * @param feature Runtime feature
+ * @return Single-bit mask, or 0 for values outside the bitmap
+ */
+constexpr uint64_t runtimeFeatureBit(RuntimeFeature feature) noexcept {
+    const auto index = static_cast<unsigned>(feature);
+    return index < 63 ? (uint64_t{1} << index) : 0;
+}
+
+//
+// AArch64 hardware capabilities reported by the Linux kernel in the auxiliary
+// vector (arch/arm64/include/uapi/asm/hwcap.h)
+//
+
+constexpr uint64_t ARM_HWCAP_ASIMD = uint64_t{1} << 1;
+constexpr uint64_t ARM_HWCAP_AES = uint64_t{1} << 3;
+constexpr uint64_t ARM_HWCAP_SHA2 = uint64_t{1} << 6;
+constexpr uint64_t ARM_HWCAP_CRC32 = uint64_t{1} << 7;
+constexpr uint64_t ARM_HWCAP_ATOMICS = uint64_t{1} << 8;
+constexpr uint64_t ARM_HWCAP_ASIMDDP = uint64_t{1} << 20;
+constexpr uint64_t ARM_HWCAP_SVE = uint64_t{1} << 22;
+constexpr uint64_t ARM_HWCAP2_SVE2 = uint64_t{1} << 1;
+constexpr uint64_t ARM_HWCAP2_RNG = uint64_t{1} << 16;
+
+/**
+ * @brief Translate AArch64 hardware capability words into a feature bitmap
+ * @param hwcap Value of getauxval(AT_HWCAP)
+ * @param hwcap2 Value of getauxval(AT_HWCAP2)
+ * @return Bitmap with bit N set when RuntimeFeature N is reported
+ */
+constexpr uint64_t armFeatureBitsFromHwcap(uint64_t hwcap, uint64_t hwcap2) noexcept {
+    uint64_t bits = 0;
+    if ((hwcap & ARM_HWCAP_ASIMD) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::neon);
+    }
+    if ((hwcap & ARM_HWCAP_AES) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::hardware_aes);
+    }
+    if ((hwcap & ARM_HWCAP_SHA2) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::sha);
+    }
+    if ((hwcap & ARM_HWCAP_CRC32) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::crc32);
+    }
+    if ((hwcap & ARM_HWCAP_ATOMICS) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::lse_atomics);
+    }
+    if ((hwcap & ARM_HWCAP_ASIMDDP) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::dotprod);
+    }
+    if ((hwcap & ARM_HWCAP_SVE) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::sve);
+    }
+    if ((hwcap2 & ARM_HWCAP2_SVE2) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::sve2);
+    }
+    if ((hwcap2 & ARM_HWCAP2_RNG) != 0) {
+        bits |= runtimeFeatureBit(RuntimeFeature::hardware_random);
+    }
+    return bits;
+}
+
+/**
+ * @brief Query the CPU for every runtime feature
+ * @return Bitmap with bit N set when RuntimeFeature N is available
+ * @note Executes CPUID several times on x86 and reads the auxiliary vector on
+ *       Linux/AArch64; callers should use cpuFeatureBits()
+ */
+inline uint64_t detectCpuFeatureBits() noexcept {
+    uint64_t bits = 0;
+    auto set_if = [&bits](RuntimeFeature feature, uint32_t reg, int bit) {
+        if ((reg & (1u << bit)) != 0) {
+            bits |= runtimeFeatureBit(feature);
+        }
+    };
+    static_cast<void>(set_if);
+
+#if TRLC_HAS_X86_INTRINSICS
+    uint32_t leaf0[4];
+    uint32_t leaf1[4] = {0, 0, 0, 0};
+    uint32_t leaf7[4] = {0, 0, 0, 0};
+    uint32_t leaf7_1[4] = {0, 0, 0, 0};
+    uint32_t ext_leaf0[4];
+    uint32_t ext_leaf1[4] = {0, 0, 0, 0};
+    cpuid(0, 0, leaf0);
+    const uint32_t max_leaf = leaf0[0];
+    if (max_leaf >= 1) {
+        cpuid(1, 0, leaf1);
+    }
+    if (max_leaf >= 7) {
+        cpuid(7, 0, leaf7);
+        if (leaf7[0] >= 1) {  // EAX holds the highest leaf 7 subleaf
+            cpuid(7, 1, leaf7_1);
+        }
+    }
+    cpuid(0x80000000u, 0, ext_leaf0);
+    if (ext_leaf0[0] >= 0x80000001u) {
+        cpuid(0x80000001u, 0, ext_leaf1);
+    }
+
+    // AVX and AVX-512 are only usable if the OS saves their register state on
+    // context switches; CPUID alone reports what the silicon implements
+    const bool has_osxsave = (leaf1[2] & (1u << 27)) != 0;  // ECX bit 27
+    const uint64_t xcr0 = has_osxsave ? xgetbv(0) : 0;
+    const bool os_avx = (xcr0 & XCR0_AVX_STATE) == XCR0_AVX_STATE;
+    const bool os_avx512 = os_avx && isOsAvx512Enabled(xcr0);
+    const uint32_t avx_leaf1_ecx = os_avx ? leaf1[2] : 0;
+    const uint32_t avx_leaf7_ebx = os_avx ? leaf7[1] : 0;
+    const uint32_t avx512_leaf7_ebx = os_avx512 ? leaf7[1] : 0;
+    const uint32_t avx_leaf7_ecx = os_avx ? leaf7[2] : 0;
+    const uint32_t avx512_leaf7_ecx = os_avx512 ? leaf7[2] : 0;
+    const uint32_t avx_leaf7_1_eax = os_avx ? leaf7_1[0] : 0;
+
+    // AMX tiles need their own XCR0 components; on Linux a process must still
+    // request them with arch_prctl(ARCH_REQ_XCOMP_PERM) before first use
+    const bool os_amx = (xcr0 & XCR0_AMX_STATE) == XCR0_AMX_STATE;
+    const uint32_t amx_leaf7_edx = os_amx ? leaf7[3] : 0;
+
+    set_if(RuntimeFeature::sse, leaf1[3], 25);              // EDX bit 25
+    set_if(RuntimeFeature::sse2, leaf1[3], 26);             // EDX bit 26
+    set_if(RuntimeFeature::sse3, leaf1[2], 0);              // ECX bit 0
+    set_if(RuntimeFeature::sse4_1, leaf1[2], 19);           // ECX bit 19
+    set_if(RuntimeFeature::sse4_2, leaf1[2], 20);           // ECX bit 20
+    set_if(RuntimeFeature::avx, avx_leaf1_ecx, 28);         // ECX bit 28
+    set_if(RuntimeFeature::avx2, avx_leaf7_ebx, 5);         // EBX bit 5
+    set_if(RuntimeFeature::avx512f, avx512_leaf7_ebx, 16);  // EBX bit 16
+    set_if(RuntimeFeature::hardware_aes, leaf1[2], 25);     // ECX bit 25
+    set_if(RuntimeFeature::hardware_random, leaf1[2], 30);  // ECX bit 30 (RDRAND)
+
+    set_if(RuntimeFeature::popcnt, leaf1[2], 23);        // ECX bit 23
+    set_if(RuntimeFeature::pclmulqdq, leaf1[2], 1);      // ECX bit 1
+    set_if(RuntimeFeature::movbe, leaf1[2], 22);         // ECX bit 22
+    set_if(RuntimeFeature::fma, avx_leaf1_ecx, 12);      // ECX bit 12
+    set_if(RuntimeFeature::f16c, avx_leaf1_ecx, 29);     // ECX bit 29
+    set_if(RuntimeFeature::lzcnt, ext_leaf1[2], 5);      // ECX bit 5 (ABM)
+    set_if(RuntimeFeature::ssse3, leaf1[2], 9);          // ECX bit 9
+    set_if(RuntimeFeature::cx16, leaf1[2], 13);          // ECX bit 13
+    set_if(RuntimeFeature::lahf_sahf, ext_leaf1[2], 0);  // ECX bit 0
+
+    set_if(RuntimeFeature::bmi1, leaf7[1], 3);                 // EBX bit 3
+    set_if(RuntimeFeature::bmi2, leaf7[1], 8);                 // EBX bit 8
+    set_if(RuntimeFeature::erms, leaf7[1], 9);                 // EBX bit 9
+    set_if(RuntimeFeature::rdseed, leaf7[1], 18);              // EBX bit 18
+    set_if(RuntimeFeature::sha, leaf7[1], 29);                 // EBX bit 29
+    set_if(RuntimeFeature::avx512dq, avx512_leaf7_ebx, 17);    // EBX bit 17
+    set_if(RuntimeFeature::avx512bw, avx512_leaf7_ebx, 30);    // EBX bit 30
+    set_if(RuntimeFeature::avx512vl, avx512_leaf7_ebx, 31);    // EBX bit 31
+    set_if(RuntimeFeature::avx512cd, avx512_leaf7_ebx, 28);    // EBX bit 28
+    set_if(RuntimeFeature::avx512vbmi, avx512_leaf7_ecx, 1);   // ECX bit 1
+    set_if(RuntimeFeature::avx512vnni, avx512_leaf7_ecx, 11);  // ECX bit 11
+    set_if(RuntimeFeature::vaes, avx_leaf7_ecx, 9);            // ECX bit 9
+    set_if(RuntimeFeature::vpclmulqdq, avx_leaf7_ecx, 10);     // ECX bit 10
+    set_if(RuntimeFeature::fsrm, leaf7[3], 4);                 // EDX bit 4
+    set_if(RuntimeFeature::amx_bf16, amx_leaf7_edx, 22);       // EDX bit 22
+    set_if(RuntimeFeature::amx_tile, amx_leaf7_edx, 24);       // EDX bit 24
+    set_if(RuntimeFeature::amx_int8, amx_leaf7_edx, 25);       // EDX bit 25
+    set_if(RuntimeFeature::avx_vnni, avx_leaf7_1_eax, 4);      // Subleaf 1 EAX bit 4
+#elif TRLC_HAS_ARM_INTRINSICS
+    #if defined(__aarch64__) && defined(__linux__)
+    // The kernel reports what the running core implements, so a generically
+    // compiled binary still sees crypto, CRC32, SVE and LSE on newer cores
+    uint64_t hwcap2 = 0;
+        #if defined(AT_HWCAP2)
+    hwcap2 = getauxval(AT_HWCAP2);
+        #endif
+    bits |= armFeatureBitsFromHwcap(getauxval(AT_HWCAP), hwcap2);
+    #endif
+
+    // Features the compiler targets are available wherever the binary runs
+    #if defined(__ARM_NEON) || defined(__aarch64__)
+    bits |= runtimeFeatureBit(RuntimeFeature::neon);  // NEON is mandatory on AArch64
+    #endif
+    #if defined(__ARM_FEATURE_AES)
+    bits |= runtimeFeatureBit(RuntimeFeature::hardware_aes);
+    #endif
+    #if defined(__ARM_FEATURE_SHA2)
+    bits |= runtimeFeatureBit(RuntimeFeature::sha);
+    #endif
+    #if defined(__ARM_FEATURE_CRC32)
+    bits |= runtimeFeatureBit(RuntimeFeature::crc32);
+    #endif
+    #if defined(__ARM_FEATURE_DOTPROD)
+    bits |= runtimeFeatureBit(RuntimeFeature::dotprod);
+    #endif
+    #if defined(__ARM_FEATURE_ATOMICS)
+    bits |= runtimeFeatureBit(RuntimeFeature::lse_atomics);
+    #endif
+    #if defined(__ARM_FEATURE_SVE)
+    bits |= runtimeFeatureBit(RuntimeFeature::sve);
+    #endif
+    #if defined(__ARM_FEATURE_SVE2)
+    bits |= runtimeFeatureBit(RuntimeFeature::sve2);
+    #endif
+#endif
+
+    return bits;
+}
+
+/// Process-wide CPU feature bitmap (zero until first populated)
+inline std::atomic<uint64_t> g_cpu_feature_bits{0};
+
+/**
+ * @brief Get the cached CPU feature bitmap, detecting it on first use
+ *
+ * After the first call every query is a single relaxed load. Threads racing
+ * on the first call may each run detection, but they store identical values.
+ *
+ * @return Bitmap with bit N set when RuntimeFeature N is available
+ */
+inline uint64_t cpuFeatureBits() noexcept {
+    uint64_t bits = g_cpu_feature_bits.load(std::memory_order_relaxed);
+    if (bits == 0) {
+        bits = detectCpuFeatureBits() | CPU_FEATURES_VALID_BIT;
+        g_cpu_feature_bits.store(bits, std::memory_order_relaxed);
+    }
+    return bits;
+}
+
+/**
+ * @brief Test a feature against the cached CPU feature bitmap
+ * @param feature Runtime feature to check
+ * @return true if feature is available
+ */
+inline bool hasCpuFeature(RuntimeFeature feature) noexcept {
+    return (cpuFeatureBits() & runtimeFeatureBit(feature)) != 0;
+}
+
+}  // namespace detail
+
+//
+// The functions below are answered from the cached CPU feature bitmap, so
+// only the first query in a process executes CPUID.
+//
+
 /**
  * @brief Detects SSE support at runtime
  * @return true if SSE is supported by the CPU
  */
 inline bool hasSseSupport() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(1, 0, 3, 25);  // EDX bit 25
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::sse);
 }
 
 /**
@@ -418,11 +845,7 @@ inline bool hasSseSupport() noexcept {
  * @return true if SSE2 is supported by the CPU
  */
 inline bool hasSse2Support() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(1, 0, 3, 26);  // EDX bit 26
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::sse2);
 }
 
 /**
@@ -430,11 +853,7 @@ inline bool hasSse2Support() noexcept {
  * @return true if SSE3 is supported by the CPU
  */
 inline bool hasSse3Support() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(1, 0, 2, 0);  // ECX bit 0
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::sse3);
 }
 
 /**
@@ -442,11 +861,7 @@ inline bool hasSse3Support() noexcept {
  * @return true if SSE4.1 is supported by the CPU
  */
 inline bool hasSse41Support() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(1, 0, 2, 19);  // ECX bit 19
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::sse4_1);
 }
 
 /**
@@ -454,47 +869,34 @@ inline bool hasSse41Support() noexcept {
  * @return true if SSE4.2 is supported by the CPU
  */
 inline bool hasSse42Support() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(1, 0, 2, 20);  // ECX bit 20
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::sse4_2);
 }
 
 /**
  * @brief Detects AVX support at runtime
- * @return true if AVX is supported by the CPU
+ * @return true if AVX is supported by the CPU and its register state is
+ *         enabled by the operating system
  */
 inline bool hasAvxSupport() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(1, 0, 2, 28);  // ECX bit 28
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::avx);
 }
 
 /**
  * @brief Detects AVX2 support at runtime
- * @return true if AVX2 is supported by the CPU
+ * @return true if AVX2 is supported by the CPU and its register state is
+ *         enabled by the operating system
  */
 inline bool hasAvx2Support() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(7, 0, 1, 5);  // EBX bit 5
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::avx2);
 }
 
 /**
  * @brief Detects AVX-512F support at runtime
- * @return true if AVX-512F is supported by the CPU
+ * @return true if AVX-512F is supported by the CPU and its register state is
+ *         enabled by the operating system
  */
 inline bool hasAvx512fSupport() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(7, 0, 1, 16);  // EBX bit 16
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::avx512f);
 }
 
 /**
@@ -502,17 +904,7 @@ inline bool hasAvx512fSupport() noexcept {
  * @return true if NEON is supported
  */
 inline bool hasNeonSupport() noexcept {
-#if TRLC_HAS_ARM_INTRINSICS
-    #ifdef __ARM_NEON
-    return true;
-    #elif defined(__aarch64__)
-    return true;  // NEON is mandatory on AArch64
-    #else
-    return false;
-    #endif
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::neon);
 }
 
 /**
@@ -520,13 +912,7 @@ inline bool hasNeonSupport() noexcept {
  * @return true if hardware AES acceleration is available
  */
 inline bool hasHardwareAes() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(1, 0, 2, 25);  // ECX bit 25
-#elif TRLC_HAS_ARM_INTRINSICS && defined(__ARM_FEATURE_AES)
-    return true;
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::hardware_aes);
 }
 
 /**
@@ -534,11 +920,263 @@ inline bool hasHardwareAes() noexcept {
  * @return true if hardware RNG is available
  */
 inline bool hasHardwareRandom() noexcept {
-#if TRLC_HAS_X86_INTRINSICS
-    return detail::checkCpuFeature(1, 0, 2, 30);  // ECX bit 30 (RDRAND)
-#else
-    return false;
-#endif
+    return detail::hasCpuFeature(RuntimeFeature::hardware_random);
+}
+
+/**
+ * @brief Detects POPCNT support at runtime
+ * @return true if POPCNT is available
+ */
+inline bool hasPopcntSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::popcnt);
+}
+
+/**
+ * @brief Detects LZCNT support at runtime
+ * @return true if LZCNT is available
+ */
+inline bool hasLzcntSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::lzcnt);
+}
+
+/**
+ * @brief Detects BMI1 support at runtime
+ * @return true if BMI1 is available
+ */
+inline bool hasBmi1Support() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::bmi1);
+}
+
+/**
+ * @brief Detects BMI2 support at runtime
+ * @return true if BMI2 is available
+ */
+inline bool hasBmi2Support() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::bmi2);
+}
+
+/**
+ * @brief Detects FMA support at runtime
+ * @return true if FMA is available
+ */
+inline bool hasFmaSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::fma);
+}
+
+/**
+ * @brief Detects F16C support at runtime
+ * @return true if F16C is available
+ */
+inline bool hasF16cSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::f16c);
+}
+
+/**
+ * @brief Detects PCLMULQDQ support at runtime
+ * @return true if PCLMULQDQ is available
+ */
+inline bool hasPclmulqdqSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::pclmulqdq);
+}
+
+/**
+ * @brief Detects SHA support at runtime
+ * @return true if SHA is available
+ */
+inline bool hasShaSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::sha);
+}
+
+/**
+ * @brief Detects VAES support at runtime
+ * @return true if VAES is available
+ */
+inline bool hasVaesSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::vaes);
+}
+
+/**
+ * @brief Detects VPCLMULQDQ support at runtime
+ * @return true if VPCLMULQDQ is available
+ */
+inline bool hasVpclmulqdqSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::vpclmulqdq);
+}
+
+/**
+ * @brief Detects AVX-512BW support at runtime
+ * @return true if AVX-512BW is available
+ */
+inline bool hasAvx512bwSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::avx512bw);
+}
+
+/**
+ * @brief Detects AVX-512DQ support at runtime
+ * @return true if AVX-512DQ is available
+ */
+inline bool hasAvx512dqSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::avx512dq);
+}
+
+/**
+ * @brief Detects AVX-512VL support at runtime
+ * @return true if AVX-512VL is available
+ */
+inline bool hasAvx512vlSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::avx512vl);
+}
+
+/**
+ * @brief Detects AVX-512 VNNI support at runtime
+ * @return true if AVX-512 VNNI is available
+ */
+inline bool hasAvx512vnniSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::avx512vnni);
+}
+
+/**
+ * @brief Detects AVX-512 VBMI support at runtime
+ * @return true if AVX-512 VBMI is available
+ */
+inline bool hasAvx512vbmiSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::avx512vbmi);
+}
+
+/**
+ * @brief Detects AVX-VNNI support at runtime
+ * @return true if AVX-VNNI is available
+ */
+inline bool hasAvxVnniSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::avx_vnni);
+}
+
+/**
+ * @brief Detects RDSEED support at runtime
+ * @return true if RDSEED is available
+ */
+inline bool hasRdseedSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::rdseed);
+}
+
+/**
+ * @brief Detects MOVBE support at runtime
+ * @return true if MOVBE is available
+ */
+inline bool hasMovbeSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::movbe);
+}
+
+/**
+ * @brief Detects ERMS support at runtime
+ * @return true if ERMS is available
+ */
+inline bool hasErmsSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::erms);
+}
+
+/**
+ * @brief Detects FSRM support at runtime
+ * @return true if FSRM is available
+ */
+inline bool hasFsrmSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::fsrm);
+}
+
+/**
+ * @brief Detects AMX-TILE support at runtime
+ * @return true if AMX-TILE is available
+ */
+inline bool hasAmxTileSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::amx_tile);
+}
+
+/**
+ * @brief Detects AMX-INT8 support at runtime
+ * @return true if AMX-INT8 is available
+ */
+inline bool hasAmxInt8Support() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::amx_int8);
+}
+
+/**
+ * @brief Detects AMX-BF16 support at runtime
+ * @return true if AMX-BF16 is available
+ */
+inline bool hasAmxBf16Support() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::amx_bf16);
+}
+
+/**
+ * @brief Detects SVE support at runtime
+ * @return true if SVE is available
+ */
+inline bool hasSveSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::sve);
+}
+
+/**
+ * @brief Detects SVE2 support at runtime
+ * @return true if SVE2 is available
+ */
+inline bool hasSve2Support() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::sve2);
+}
+
+/**
+ * @brief Detects CRC32 support at runtime
+ * @return true if CRC32 is available
+ */
+inline bool hasCrc32Support() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::crc32);
+}
+
+/**
+ * @brief Detects DotProd support at runtime
+ * @return true if DotProd is available
+ */
+inline bool hasDotprodSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::dotprod);
+}
+
+/**
+ * @brief Detects LSE atomics support at runtime
+ * @return true if LSE atomics is available
+ */
+inline bool hasLseAtomicsSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::lse_atomics);
+}
+
+/**
+ * @brief Detects SSSE3 support at runtime
+ * @return true if SSSE3 is available
+ */
+inline bool hasSsse3Support() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::ssse3);
+}
+
+/**
+ * @brief Detects CMPXCHG16B support at runtime
+ * @return true if CMPXCHG16B is available
+ */
+inline bool hasCx16Support() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::cx16);
+}
+
+/**
+ * @brief Detects LAHF-SAHF support at runtime
+ * @return true if LAHF-SAHF is available
+ */
+inline bool hasLahfSahfSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::lahf_sahf);
+}
+
+/**
+ * @brief Detects AVX-512CD support at runtime
+ * @return true if AVX-512CD is available
+ */
+inline bool hasAvx512cdSupport() noexcept {
+    return detail::hasCpuFeature(RuntimeFeature::avx512cd);
 }
 
 //
@@ -548,7 +1186,8 @@ inline bool hasHardwareRandom() noexcept {
 /**
  * @brief Gets a complete feature set with all detected features
  * @return FeatureSet containing all available features
- * @note Language features are compile-time, runtime features require detection
+ * @note Language features are compile-time; runtime fields are always false
+ *       here. Use getRuntimeFeatureSet() for the detected CPU features.
  */
 constexpr FeatureSet getFeatureSet() noexcept {
     return FeatureSet{
@@ -576,10 +1215,117 @@ constexpr FeatureSet getFeatureSet() noexcept {
         false,  // has_avx512f
         false,  // has_neon
         false,  // has_hardware_aes
-        false   // has_hardware_random
+        false,  // has_hardware_random
+        false,  // has_popcnt
+        false,  // has_lzcnt
+        false,  // has_bmi1
+        false,  // has_bmi2
+        false,  // has_fma
+        false,  // has_f16c
+        false,  // has_pclmulqdq
+        false,  // has_sha
+        false,  // has_vaes
+        false,  // has_vpclmulqdq
+        false,  // has_avx512bw
+        false,  // has_avx512dq
+        false,  // has_avx512vl
+        false,  // has_avx512vnni
+        false,  // has_avx512vbmi
+        false,  // has_avx_vnni
+        false,  // has_rdseed
+        false,  // has_movbe
+        false,  // has_erms
+        false,  // has_fsrm
+        false,  // has_amx_tile
+        false,  // has_amx_int8
+        false,  // has_amx_bf16
+        false,  // has_sve
+        false,  // has_sve2
+        false,  // has_crc32
+        false,  // has_dotprod
+        false,  // has_lse_atomics
+        false,  // has_ssse3
+        false,  // has_cx16
+        false,  // has_lahf_sahf
+        false   // has_avx512cd
     };
 }
 
+namespace detail {
+
+/**
+ * @brief Build a feature set from a CPU feature bitmap
+ * @param bits Bitmap as returned by cpuFeatureBits()
+ * @return Compile-time language features combined with the runtime bits
+ */
+constexpr FeatureSet makeRuntimeFeatureSet(uint64_t bits) noexcept {
+    FeatureSet features = getFeatureSet();
+    auto has = [bits](RuntimeFeature feature) {
+        return (bits & runtimeFeatureBit(feature)) != 0;
+    };
+
+    features.has_sse = has(RuntimeFeature::sse);
+    features.has_sse2 = has(RuntimeFeature::sse2);
+    features.has_sse3 = has(RuntimeFeature::sse3);
+    features.has_sse4_1 = has(RuntimeFeature::sse4_1);
+    features.has_sse4_2 = has(RuntimeFeature::sse4_2);
+    features.has_avx = has(RuntimeFeature::avx);
+    features.has_avx2 = has(RuntimeFeature::avx2);
+    features.has_avx512f = has(RuntimeFeature::avx512f);
+    features.has_neon = has(RuntimeFeature::neon);
+    features.has_hardware_aes = has(RuntimeFeature::hardware_aes);
+    features.has_hardware_random = has(RuntimeFeature::hardware_random);
+    features.has_popcnt = has(RuntimeFeature::popcnt);
+    features.has_lzcnt = has(RuntimeFeature::lzcnt);
+    features.has_bmi1 = has(RuntimeFeature::bmi1);
+    features.has_bmi2 = has(RuntimeFeature::bmi2);
+    features.has_fma = has(RuntimeFeature::fma);
+    features.has_f16c = has(RuntimeFeature::f16c);
+    features.has_pclmulqdq = has(RuntimeFeature::pclmulqdq);
+    features.has_sha = has(RuntimeFeature::sha);
+    features.has_vaes = has(RuntimeFeature::vaes);
+    features.has_vpclmulqdq = has(RuntimeFeature::vpclmulqdq);
+    features.has_avx512bw = has(RuntimeFeature::avx512bw);
+    features.has_avx512dq = has(RuntimeFeature::avx512dq);
+    features.has_avx512vl = has(RuntimeFeature::avx512vl);
+    features.has_avx512vnni = has(RuntimeFeature::avx512vnni);
+    features.has_avx512vbmi = has(RuntimeFeature::avx512vbmi);
+    features.has_avx_vnni = has(RuntimeFeature::avx_vnni);
+    features.has_rdseed = has(RuntimeFeature::rdseed);
+    features.has_movbe = has(RuntimeFeature::movbe);
+    features.has_erms = has(RuntimeFeature::erms);
+    features.has_fsrm = has(RuntimeFeature::fsrm);
+    features.has_amx_tile = has(RuntimeFeature::amx_tile);
+    features.has_amx_int8 = has(RuntimeFeature::amx_int8);
+    features.has_amx_bf16 = has(RuntimeFeature::amx_bf16);
+    features.has_sve = has(RuntimeFeature::sve);
+    features.has_sve2 = has(RuntimeFeature::sve2);
+    features.has_crc32 = has(RuntimeFeature::crc32);
+    features.has_dotprod = has(RuntimeFeature::dotprod);
+    features.has_lse_atomics = has(RuntimeFeature::lse_atomics);
+    features.has_ssse3 = has(RuntimeFeature::ssse3);
+    features.has_cx16 = has(RuntimeFeature::cx16);
+    features.has_lahf_sahf = has(RuntimeFeature::lahf_sahf);
+    features.has_avx512cd = has(RuntimeFeature::avx512cd);
+    return features;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Gets a complete feature set including detected CPU features
+ *
+ * Unlike getFeatureSet(), the runtime fields reflect the CPU the process is
+ * running on. The set is built once from the cached CPU feature bitmap, so
+ * dispatch code can take a single snapshot at startup.
+ *
+ * @return FeatureSet with both language and runtime features populated
+ */
+inline FeatureSet getRuntimeFeatureSet() noexcept {
+    static const FeatureSet features = detail::makeRuntimeFeatureSet(detail::cpuFeatureBits());
+    return features;
+}
+
 /**
  * @brief Checks if a specific language feature is available
  * @param feature Language feature to check
@@ -618,35 +1364,254 @@ constexpr bool hasLanguageFeature(LanguageFeature feature) noexcept {
  * @brief Checks if a specific runtime feature is available
  * @param feature Runtime feature to check
  * @return true if feature is available (requires runtime detection)
- * @note This function is not constexpr as it may require CPU feature detection
+ * @note The first call detects and caches all CPU features; later calls are a
+ *       single load-and-test of the cached bitmap
  */
 inline bool hasRuntimeFeature(RuntimeFeature feature) noexcept {
+    return detail::hasCpuFeature(feature);
+}
+
+/**
+ * @brief Get the conventional short name of a runtime feature
+ * @param feature Runtime feature
+ * @return Feature name as used by vendor documentation (e.g. "AVX-512BW")
+ */
+constexpr const char* runtimeFeatureName(RuntimeFeature feature) noexcept {
     switch (feature) {
         case RuntimeFeature::sse:
-            return hasSseSupport();
+            return "SSE";
         case RuntimeFeature::sse2:
-            return hasSse2Support();
+            return "SSE2";
         case RuntimeFeature::sse3:
-            return hasSse3Support();
+            return "SSE3";
         case RuntimeFeature::sse4_1:
-            return hasSse41Support();
+            return "SSE4.1";
         case RuntimeFeature::sse4_2:
-            return hasSse42Support();
+            return "SSE4.2";
         case RuntimeFeature::avx:
-            return hasAvxSupport();
+            return "AVX";
         case RuntimeFeature::avx2:
-            return hasAvx2Support();
+            return "AVX2";
         case RuntimeFeature::avx512f:
-            return hasAvx512fSupport();
+            return "AVX-512F";
         case RuntimeFeature::neon:
-            return hasNeonSupport();
+            return "NEON";
         case RuntimeFeature::hardware_aes:
-            return hasHardwareAes();
+            return "AES";
         case RuntimeFeature::hardware_random:
-            return hasHardwareRandom();
+            return "RDRAND";
+        case RuntimeFeature::popcnt:
+            return "POPCNT";
+        case RuntimeFeature::lzcnt:
+            return "LZCNT";
+        case RuntimeFeature::bmi1:
+            return "BMI1";
+        case RuntimeFeature::bmi2:
+            return "BMI2";
+        case RuntimeFeature::fma:
+            return "FMA";
+        case RuntimeFeature::f16c:
+            return "F16C";
+        case RuntimeFeature::pclmulqdq:
+            return "PCLMULQDQ";
+        case RuntimeFeature::sha:
+            return "SHA";
+        case RuntimeFeature::vaes:
+            return "VAES";
+        case RuntimeFeature::vpclmulqdq:
+            return "VPCLMULQDQ";
+        case RuntimeFeature::avx512bw:
+            return "AVX-512BW";
+        case RuntimeFeature::avx512dq:
+            return "AVX-512DQ";
+        case RuntimeFeature::avx512vl:
+            return "AVX-512VL";
+        case RuntimeFeature::avx512vnni:
+            return "AVX-512VNNI";
+        case RuntimeFeature::avx512vbmi:
+            return "AVX-512VBMI";
+        case RuntimeFeature::avx_vnni:
+            return "AVX-VNNI";
+        case RuntimeFeature::rdseed:
+            return "RDSEED";
+        case RuntimeFeature::movbe:
+            return "MOVBE";
+        case RuntimeFeature::erms:
+            return "ERMS";
+        case RuntimeFeature::fsrm:
+            return "FSRM";
+        case RuntimeFeature::amx_tile:
+            return "AMX-TILE";
+        case RuntimeFeature::amx_int8:
+            return "AMX-INT8";
+        case RuntimeFeature::amx_bf16:
+            return "AMX-BF16";
+        case RuntimeFeature::sve:
+            return "SVE";
+        case RuntimeFeature::sve2:
+            return "SVE2";
+        case RuntimeFeature::crc32:
+            return "CRC32";
+        case RuntimeFeature::dotprod:
+            return "DOTPROD";
+        case RuntimeFeature::lse_atomics:
+            return "LSE";
+        case RuntimeFeature::ssse3:
+            return "SSSE3";
+        case RuntimeFeature::cx16:
+            return "CMPXCHG16B";
+        case RuntimeFeature::lahf_sahf:
+            return "LAHF-SAHF";
+        case RuntimeFeature::avx512cd:
+            return "AVX-512CD";
         default:
-            return false;
+            return "Unknown";
+    }
+}
+
+/**
+ * @brief Build a bitmap of runtime features
+ * @param features Features to include
+ * @return Bitmap with the bit of every listed feature set
+ */
+constexpr uint64_t runtimeFeatureMask(std::initializer_list<RuntimeFeature> features) noexcept {
+    uint64_t mask = 0;
+    for (RuntimeFeature feature : features) {
+        mask |= detail::runtimeFeatureBit(feature);
+    }
+    return mask;
+}
+
+/**
+ * @brief Checks that every feature in a bitmap is available
+ * @param mask Bitmap built with runtimeFeatureMask()
+ * @return true if all features in @p mask are available (true for an empty mask)
+ */
+inline bool hasAllRuntimeFeatures(uint64_t mask) noexcept {
+    return (detail::cpuFeatureBits() & mask) == mask;
+}
+
+//
+// x86-64 microarchitecture levels
+//
+
+/**
+ * @brief x86-64 microarchitecture levels defined by the x86-64 psABI
+ *
+ * Levels are cumulative, so they can be compared directly:
+ * `getX86Level() >= X86Level::v3` selects code built with -march=x86-64-v3.
+ */
+enum class X86Level : int {
+    none = 0,  ///< Not an x86-64 target
+    baseline,  ///< x86-64: CMOV, CX8, FPU, FXSR, MMX, SCE, SSE, SSE2
+    v2,        ///< x86-64-v2: + CMPXCHG16B, LAHF/SAHF, POPCNT, SSE3, SSE4.1, SSE4.2, SSSE3
+    v3,        ///< x86-64-v3: + AVX, AVX2, BMI1, BMI2, F16C, FMA, LZCNT, MOVBE, OSXSAVE
+    v4         ///< x86-64-v4: + AVX512F, AVX512BW, AVX512CD, AVX512DQ, AVX512VL
+};
+
+/**
+ * @brief Get the runtime features a microarchitecture level requires
+ *
+ * The mask includes the requirements of all lower levels. OSXSAVE has no
+ * RuntimeFeature of its own; the AVX bits are only set when the OS enabled
+ * the register state, which covers it.
+ *
+ * @param level Microarchitecture level
+ * @return Bitmap suitable for hasAllRuntimeFeatures()
+ */
+constexpr uint64_t x86LevelFeatureMask(X86Level level) noexcept {
+    constexpr uint64_t baseline = runtimeFeatureMask({RuntimeFeature::sse, RuntimeFeature::sse2});
+    constexpr uint64_t v2 = baseline | runtimeFeatureMask({RuntimeFeature::cx16,
+                                                           RuntimeFeature::lahf_sahf,
+                                                           RuntimeFeature::popcnt,
+                                                           RuntimeFeature::sse3,
+                                                           RuntimeFeature::sse4_1,
+                                                           RuntimeFeature::sse4_2,
+                                                           RuntimeFeature::ssse3});
+    constexpr uint64_t v3 = v2 | runtimeFeatureMask({RuntimeFeature::avx,
+                                                     RuntimeFeature::avx2,
+                                                     RuntimeFeature::bmi1,
+                                                     RuntimeFeature::bmi2,
+                                                     RuntimeFeature::f16c,
+                                                     RuntimeFeature::fma,
+                                                     RuntimeFeature::lzcnt,
+                                                     RuntimeFeature::movbe});
+    constexpr uint64_t v4 = v3 | runtimeFeatureMask({RuntimeFeature::avx512f,
+                                                     RuntimeFeature::avx512bw,
+                                                     RuntimeFeature::avx512cd,
+                                                     RuntimeFeature::avx512dq,
+                                                     RuntimeFeature::avx512vl});
+    switch (level) {
+        case X86Level::baseline:
+            return baseline;
+        case X86Level::v2:
+            return v2;
+        case X86Level::v3:
+            return v3;
+        case X86Level::v4:
+            return v4;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Get the display name of a microarchitecture level
+ * @param level Microarchitecture level
+ * @return Name matching the -march spelling (e.g. "x86-64-v3")
+ */
+constexpr const char* x86LevelName(X86Level level) noexcept {
+    switch (level) {
+        case X86Level::baseline:
+            return "x86-64";
+        case X86Level::v2:
+            return "x86-64-v2";
+        case X86Level::v3:
+            return "x86-64-v3";
+        case X86Level::v4:
+            return "x86-64-v4";
+        default:
+            return "none";
+    }
+}
+
+namespace detail {
+
+/**
+ * @brief Compute the highest microarchitecture level a feature bitmap satisfies
+ * @param bits Bitmap as returned by cpuFeatureBits()
+ * @return Highest level whose requirements are all present
+ */
+constexpr X86Level x86LevelFromBits(uint64_t bits) noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+    X86Level level = X86Level::none;
+    for (X86Level candidate : {X86Level::baseline, X86Level::v2, X86Level::v3, X86Level::v4}) {
+        const uint64_t mask = x86LevelFeatureMask(candidate);
+        if ((bits & mask) != mask) {
+            break;
+        }
+        level = candidate;
     }
+    return level;
+#else
+    static_cast<void>(bits);
+    return X86Level::none;
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief Get the x86-64 microarchitecture level of the running CPU
+ *
+ * Computed once from the cached feature bitmap; later calls return the
+ * stored value.
+ *
+ * @return Highest supported level, or X86Level::none on non-x86-64 targets
+ */
+inline X86Level getX86Level() noexcept {
+    static const X86Level level = detail::x86LevelFromBits(detail::cpuFeatureBits());
+    return level;
 }
 
 /**
@@ -740,6 +1705,102 @@ constexpr bool hasFeature() noexcept {
 /// Check hardware RNG support at runtime
 #define TRLC_HAS_HARDWARE_RANDOM_RUNTIME() (trlc::platform::hasHardwareRandom())
 
+/// Check POPCNT support at runtime
+#define TRLC_HAS_POPCNT_RUNTIME() (trlc::platform::hasPopcntSupport())
+
+/// Check LZCNT support at runtime
+#define TRLC_HAS_LZCNT_RUNTIME() (trlc::platform::hasLzcntSupport())
+
+/// Check BMI1 support at runtime
+#define TRLC_HAS_BMI1_RUNTIME() (trlc::platform::hasBmi1Support())
+
+/// Check BMI2 support at runtime
+#define TRLC_HAS_BMI2_RUNTIME() (trlc::platform::hasBmi2Support())
+
+/// Check FMA support at runtime
+#define TRLC_HAS_FMA_RUNTIME() (trlc::platform::hasFmaSupport())
+
+/// Check F16C support at runtime
+#define TRLC_HAS_F16C_RUNTIME() (trlc::platform::hasF16cSupport())
+
+/// Check PCLMULQDQ support at runtime
+#define TRLC_HAS_PCLMULQDQ_RUNTIME() (trlc::platform::hasPclmulqdqSupport())
+
+/// Check SHA support at runtime
+#define TRLC_HAS_SHA_RUNTIME() (trlc::platform::hasShaSupport())
+
+/// Check VAES support at runtime
+#define TRLC_HAS_VAES_RUNTIME() (trlc::platform::hasVaesSupport())
+
+/// Check VPCLMULQDQ support at runtime
+#define TRLC_HAS_VPCLMULQDQ_RUNTIME() (trlc::platform::hasVpclmulqdqSupport())
+
+/// Check AVX-512BW support at runtime
+#define TRLC_HAS_AVX512BW_RUNTIME() (trlc::platform::hasAvx512bwSupport())
+
+/// Check AVX-512DQ support at runtime
+#define TRLC_HAS_AVX512DQ_RUNTIME() (trlc::platform::hasAvx512dqSupport())
+
+/// Check AVX-512VL support at runtime
+#define TRLC_HAS_AVX512VL_RUNTIME() (trlc::platform::hasAvx512vlSupport())
+
+/// Check AVX-512 VNNI support at runtime
+#define TRLC_HAS_AVX512VNNI_RUNTIME() (trlc::platform::hasAvx512vnniSupport())
+
+/// Check AVX-512 VBMI support at runtime
+#define TRLC_HAS_AVX512VBMI_RUNTIME() (trlc::platform::hasAvx512vbmiSupport())
+
+/// Check AVX-VNNI support at runtime
+#define TRLC_HAS_AVX_VNNI_RUNTIME() (trlc::platform::hasAvxVnniSupport())
+
+/// Check RDSEED support at runtime
+#define TRLC_HAS_RDSEED_RUNTIME() (trlc::platform::hasRdseedSupport())
+
+/// Check MOVBE support at runtime
+#define TRLC_HAS_MOVBE_RUNTIME() (trlc::platform::hasMovbeSupport())
+
+/// Check ERMS support at runtime
+#define TRLC_HAS_ERMS_RUNTIME() (trlc::platform::hasErmsSupport())
+
+/// Check FSRM support at runtime
+#define TRLC_HAS_FSRM_RUNTIME() (trlc::platform::hasFsrmSupport())
+
+/// Check AMX-TILE support at runtime
+#define TRLC_HAS_AMX_TILE_RUNTIME() (trlc::platform::hasAmxTileSupport())
+
+/// Check AMX-INT8 support at runtime
+#define TRLC_HAS_AMX_INT8_RUNTIME() (trlc::platform::hasAmxInt8Support())
+
+/// Check AMX-BF16 support at runtime
+#define TRLC_HAS_AMX_BF16_RUNTIME() (trlc::platform::hasAmxBf16Support())
+
+/// Check SVE support at runtime
+#define TRLC_HAS_SVE_RUNTIME() (trlc::platform::hasSveSupport())
+
+/// Check SVE2 support at runtime
+#define TRLC_HAS_SVE2_RUNTIME() (trlc::platform::hasSve2Support())
+
+/// Check CRC32 support at runtime
+#define TRLC_HAS_CRC32_RUNTIME() (trlc::platform::hasCrc32Support())
+
+/// Check DotProd support at runtime
+#define TRLC_HAS_DOTPROD_RUNTIME() (trlc::platform::hasDotprodSupport())
+
+/// Check LSE atomics support at runtime
+#define TRLC_HAS_LSE_ATOMICS_RUNTIME() (trlc::platform::hasLseAtomicsSupport())
+
+/// Check SSSE3 support at runtime
+#define TRLC_HAS_SSSE3_RUNTIME() (trlc::platform::hasSsse3Support())
+
+/// Check CMPXCHG16B support at runtime
+#define TRLC_HAS_CX16_RUNTIME() (trlc::platform::hasCx16Support())
+
+/// Check LAHF-SAHF support at runtime
+#define TRLC_HAS_LAHF_SAHF_RUNTIME() (trlc::platform::hasLahfSahfSupport())
+
+/// Check AVX-512CD support at runtime
+#define TRLC_HAS_AVX512CD_RUNTIME() (trlc::platform::hasAvx512cdSupport())
+
 //
 // Conditional compilation helpers
 //
@@ -280,6 +280,27 @@ constexpr bool hasAttributeSupport(const char* /* attribute_name */) noexcept {
     #define TRLC_NEVER_INLINE
 #endif
 
+/**
+ * @brief Compile a function for an instruction set extension
+ *
+ * Allows one translation unit to hold implementations for several
+ * instruction sets, one of which is then selected at runtime (see
+ * dispatch.hpp). MSVC accepts intrinsics of any extension without
+ * annotation, so the macro expands to nothing there.
+ *
+ * @param isa GCC/Clang target string, e.g. "avx2" or "avx512f,avx512bw"
+ *
+ * @example
+ * @code
+ * TRLC_TARGET("avx2") void addAvx2(float* data, size_t size);
+ * @endcode
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define TRLC_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define TRLC_TARGET(isa)
+#endif
+
 /**
  * @brief Standard inline hint
  *
@@ -0,0 +1,528 @@
+#pragma once
+
+/**
+ * @file memory.hpp
+ * @brief Runtime memory page size, huge page availability and huge page buffers
+ *
+ * getPageSize() in typeinfo.hpp is a compile-time estimate. The queries in
+ * this header ask the running kernel, which matters on systems configured
+ * with 16 KiB or 64 KiB base pages and for deciding whether huge pages can
+ * actually be obtained. HugePageBuffer allocates large regions on huge
+ * pages when the system allows it, cutting TLB misses for tables that are
+ * accessed at random.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "trlc/platform/detail/sysfs.hpp"
+#include "trlc/platform/typeinfo.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <dirent.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace trlc {
+namespace platform {
+
+//
+// Base page size
+//
+
+namespace detail {
+
+/**
+ * @brief Ask the operating system for the base page size
+ * @return Page size in bytes, or the compile-time estimate if unavailable
+ */
+inline size_t detectRuntimePageSize() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+    const long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size > 0) {
+        return static_cast<size_t>(page_size);
+    }
+#endif
+    return getPageSize();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Get the base memory page size of the running system
+ *
+ * Queried once with sysconf(_SC_PAGESIZE) and cached. On systems without
+ * sysconf the compile-time estimate from getPageSize() is returned.
+ *
+ * @return Page size in bytes (e.g. 4096, 16384 or 65536)
+ */
+inline size_t getRuntimePageSize() noexcept {
+    static const size_t page_size = detail::detectRuntimePageSize();
+    return page_size;
+}
+
+//
+// Huge pages
+//
+
+/**
+ * @brief Transparent huge page policy configured in the kernel
+ */
+enum class TransparentHugePageMode : int {
+    unavailable = 0,  ///< Kernel has no transparent huge page support
+    always,           ///< Huge pages are used for all suitable anonymous mappings
+    madvise,          ///< Huge pages are used only for regions marked MADV_HUGEPAGE
+    never             ///< Transparent huge pages are disabled
+};
+
+/**
+ * @brief Explicit (hugetlbfs) huge page pool of one page size
+ */
+struct HugePagePool {
+    size_t page_size;      ///< Huge page size in bytes
+    uint64_t total_pages;  ///< Pages reserved in the pool (nr_hugepages)
+    uint64_t free_pages;   ///< Pages currently available for allocation
+};
+
+/**
+ * @brief Huge page configuration of the running system
+ */
+struct HugePageInfo {
+    std::vector<HugePagePool> pools;           ///< Explicit huge page pools, smallest first
+    size_t default_page_size;                  ///< Default huge page size (0 if none)
+    TransparentHugePageMode transparent_mode;  ///< Transparent huge page policy
+    size_t transparent_page_size;              ///< Transparent huge page size (0 if unknown)
+
+    /**
+     * @brief Find the explicit pool of a given page size
+     * @param page_size Huge page size in bytes
+     * @return Pointer to the pool, or nullptr if the size is not supported
+     */
+    const HugePagePool* findPool(size_t page_size) const noexcept {
+        for (const HugePagePool& pool : pools) {
+            if (pool.page_size == page_size) {
+                return &pool;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Check whether explicit huge pages of a size can be allocated
+     * @param page_size Huge page size in bytes
+     * @param count Number of pages needed
+     * @return true if the pool had at least @p count free pages when read
+     */
+    bool hasFreePages(size_t page_size, uint64_t count = 1) const noexcept {
+        const HugePagePool* pool = findPool(page_size);
+        return pool != nullptr && pool->free_pages >= count;
+    }
+
+    /**
+     * @brief Check whether madvise(MADV_HUGEPAGE) can yield huge pages
+     * @return true if transparent huge pages are in "always" or "madvise" mode
+     */
+    bool isTransparentAvailable() const noexcept {
+        return transparent_mode == TransparentHugePageMode::always ||
+               transparent_mode == TransparentHugePageMode::madvise;
+    }
+};
+
+/**
+ * @brief Get the display name of a transparent huge page mode
+ * @param mode Transparent huge page mode
+ * @return Name as written in sysfs, or "unavailable"
+ */
+constexpr const char* transparentHugePageModeName(TransparentHugePageMode mode) noexcept {
+    switch (mode) {
+        case TransparentHugePageMode::always:
+            return "always";
+        case TransparentHugePageMode::madvise:
+            return "madvise";
+        case TransparentHugePageMode::never:
+            return "never";
+        default:
+            return "unavailable";
+    }
+}
+
+namespace detail {
+
+/**
+ * @brief Parse the selected mode from a sysfs policy file
+ * @param text Contents such as "always [madvise] never"
+ * @return Selected mode, or unavailable if none is marked
+ */
+inline TransparentHugePageMode parseTransparentHugePageMode(const std::string& text) {
+    const size_t open = text.find('[');
+    const size_t close = text.find(']', open);
+    if (open == std::string::npos || close == std::string::npos) {
+        return TransparentHugePageMode::unavailable;
+    }
+
+    const std::string selected = text.substr(open + 1, close - open - 1);
+    if (selected == "always") {
+        return TransparentHugePageMode::always;
+    }
+    if (selected == "madvise") {
+        return TransparentHugePageMode::madvise;
+    }
+    if (selected == "never") {
+        return TransparentHugePageMode::never;
+    }
+    return TransparentHugePageMode::unavailable;
+}
+
+/**
+ * @brief Read the explicit huge page pools from sysfs
+ * @param root Pool directory, normally "/sys/kernel/mm/hugepages"
+ * @return Pools sorted by page size
+ */
+inline std::vector<HugePagePool> readHugePagePools(const std::string& root) {
+    std::vector<HugePagePool> pools;
+#if defined(__unix__) || defined(__APPLE__)
+    DIR* dir = opendir(root.c_str());
+    if (dir == nullptr) {
+        return pools;
+    }
+
+    // Entries are named "hugepages-<size>kB"
+    const std::string prefix = "hugepages-";
+    while (const dirent* entry = readdir(dir)) {
+        const std::string name = entry->d_name;
+        if (name.compare(0, prefix.size(), prefix) != 0) {
+            continue;
+        }
+
+        uint64_t size_kb = 0;
+        if (!parseUnsigned(name.substr(prefix.size()), size_kb)) {
+            continue;
+        }
+
+        HugePagePool pool{static_cast<size_t>(size_kb * 1024), 0, 0};
+        const std::string pool_dir = root + "/" + name + "/";
+        readUnsigned(pool_dir + "nr_hugepages", pool.total_pages);
+        readUnsigned(pool_dir + "free_hugepages", pool.free_pages);
+        pools.push_back(pool);
+    }
+    closedir(dir);
+
+    std::sort(pools.begin(), pools.end(), [](const HugePagePool& lhs, const HugePagePool& rhs) {
+        return lhs.page_size < rhs.page_size;
+    });
+#else
+    static_cast<void>(root);
+#endif
+    return pools;
+}
+
+/**
+ * @brief Read the default huge page size from /proc/meminfo
+ * @return Size in bytes, or 0 if the kernel does not report one
+ */
+inline size_t readDefaultHugePageSize() {
+    size_t size = 0;
+    forEachLine("/proc/meminfo", [&size](const std::string& line) {
+        const std::string key = "Hugepagesize:";
+        if (line.compare(0, key.size(), key) != 0) {
+            return true;
+        }
+        uint64_t size_kb = 0;
+        if (parseUnsigned(line.substr(key.size()), size_kb)) {
+            size = static_cast<size_t>(size_kb * 1024);
+        }
+        return false;
+    });
+    return size;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Read the current huge page configuration
+ *
+ * Every call reads sysfs again, so free page counts are up to date. Use
+ * getHugePageInfo() when a snapshot taken at startup is sufficient.
+ *
+ * @return Huge page information; empty on systems without huge page support
+ */
+inline HugePageInfo readHugePageInfo() {
+    HugePageInfo info{};
+    info.pools = detail::readHugePagePools("/sys/kernel/mm/hugepages");
+    info.default_page_size = detail::readDefaultHugePageSize();
+
+    std::string text;
+    if (detail::readFirstLine("/sys/kernel/mm/transparent_hugepage/enabled", text)) {
+        info.transparent_mode = detail::parseTransparentHugePageMode(text);
+    }
+
+    uint64_t size = 0;
+    if (detail::readUnsigned("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", size)) {
+        info.transparent_page_size = static_cast<size_t>(size);
+    }
+    return info;
+}
+
+/**
+ * @brief Get the huge page configuration read at first use
+ *
+ * Page sizes and the transparent huge page mode rarely change while a
+ * process runs; free page counts do, so check readHugePageInfo() right
+ * before relying on explicit pools for a large allocation.
+ *
+ * @return Cached huge page information
+ */
+inline const HugePageInfo& getHugePageInfo() noexcept {
+    // Reading the pools allocates; running out of memory reports no huge pages
+    static const HugePageInfo info = [] {
+        try {
+            return readHugePageInfo();
+        } catch (...) {
+            return HugePageInfo{{}, 0, TransparentHugePageMode::unavailable, 0};
+        }
+    }();
+    return info;
+}
+
+//
+// Huge page buffers
+//
+
+/**
+ * @brief Kind of pages backing a HugePageBuffer, weakest first
+ */
+enum class HugePageBacking : int {
+    none = 0,      ///< No memory allocated
+    normal,        ///< Base pages
+    transparent,   ///< Region advised for transparent huge pages (MADV_HUGEPAGE)
+    explicit_pool  ///< Pages reserved from the hugetlbfs pool (MAP_HUGETLB)
+};
+
+/**
+ * @brief Get the display name of a huge page backing
+ * @param backing Backing kind
+ * @return Short description such as "transparent huge pages"
+ */
+constexpr const char* hugePageBackingName(HugePageBacking backing) noexcept {
+    switch (backing) {
+        case HugePageBacking::normal:
+            return "normal pages";
+        case HugePageBacking::transparent:
+            return "transparent huge pages";
+        case HugePageBacking::explicit_pool:
+            return "explicit huge pages";
+        default:
+            return "none";
+    }
+}
+
+/**
+ * @brief Page-aligned memory region backed by huge pages where possible
+ *
+ * Allocation tries, in order and starting no stronger than requested:
+ * an explicit huge page mapping (MAP_HUGETLB) of the default huge page
+ * size, an anonymous mapping aligned to the transparent huge page size and
+ * advised with MADV_HUGEPAGE, and finally ordinary pages. backing() reports
+ * which one succeeded. Transparent huge pages are a request; the kernel
+ * may still use base pages for parts of the region if it cannot find
+ * contiguous memory.
+ *
+ * The memory is zero-initialized and owned by the buffer.
+ *
+ * @example
+ * @code
+ * trlc::platform::HugePageBuffer table(512 << 20);
+ * auto* slots = static_cast<uint64_t*>(table.data());
+ * std::printf("Backed by %s\n", hugePageBackingName(table.backing()));
+ * @endcode
+ */
+class HugePageBuffer {
+public:
+    /// Create an empty buffer
+    HugePageBuffer() noexcept = default;
+
+    /**
+     * @brief Allocate a buffer
+     * @param bytes Size in bytes
+     * @param strongest Strongest backing to try; weaker ones are used as fallback
+     * @throws std::bad_alloc if not even normal pages can be mapped
+     */
+    explicit HugePageBuffer(size_t bytes,
+                            HugePageBacking strongest = HugePageBacking::explicit_pool)
+        : _size(bytes) {
+        if (bytes == 0) {
+            return;
+        }
+        if (strongest >= HugePageBacking::explicit_pool && mapExplicit()) {
+            return;
+        }
+        if (strongest >= HugePageBacking::transparent && mapTransparent()) {
+            return;
+        }
+        mapNormal();
+    }
+
+    ~HugePageBuffer() { release(); }
+
+    HugePageBuffer(const HugePageBuffer&) = delete;
+    HugePageBuffer& operator=(const HugePageBuffer&) = delete;
+
+    HugePageBuffer(HugePageBuffer&& other) noexcept { swap(other); }
+
+    HugePageBuffer& operator=(HugePageBuffer&& other) noexcept {
+        if (this != &other) {
+            HugePageBuffer(std::move(other)).swap(*this);
+        }
+        return *this;
+    }
+
+    /// @return Start of the buffer, aligned to at least pageSize()
+    void* data() const noexcept { return _data; }
+
+    /// @return Requested size in bytes
+    size_t size() const noexcept { return _size; }
+
+    /// @return Bytes actually mapped (the size rounded up to whole pages)
+    size_t mappedSize() const noexcept { return _mapped_size; }
+
+    /// @return Page size the buffer was laid out for
+    size_t pageSize() const noexcept { return _page_size; }
+
+    /// @return Kind of pages backing the buffer
+    HugePageBacking backing() const noexcept { return _backing; }
+
+    /// @return true if explicit or transparent huge pages were used
+    bool usesHugePages() const noexcept { return _backing >= HugePageBacking::transparent; }
+
+    /// @return true if the buffer holds memory
+    explicit operator bool() const noexcept { return _data != nullptr; }
+
+    /// Exchange the contents of two buffers
+    void swap(HugePageBuffer& other) noexcept {
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+        std::swap(_mapped_size, other._mapped_size);
+        std::swap(_page_size, other._page_size);
+        std::swap(_backing, other._backing);
+    }
+
+private:
+    /// Huge page size assumed when the kernel does not report one
+    static constexpr size_t DEFAULT_HUGE_PAGE_SIZE = size_t(2) << 20;
+
+    bool mapExplicit() noexcept {
+#if defined(__linux__) && defined(MAP_HUGETLB)
+        size_t page_size = getHugePageInfo().default_page_size;
+        if (page_size == 0) {
+            page_size = DEFAULT_HUGE_PAGE_SIZE;
+        }
+        const size_t mapped = alignedSize(_size, page_size);
+        void* memory = mmap(nullptr,
+                            mapped,
+                            PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                            -1,
+                            0);
+        if (memory == MAP_FAILED) {
+            return false;
+        }
+        adopt(memory, mapped, page_size, HugePageBacking::explicit_pool);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool mapTransparent() noexcept {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        const HugePageInfo& info = getHugePageInfo();
+        if (!info.isTransparentAvailable()) {
+            return false;
+        }
+        const size_t page_size =
+            info.transparent_page_size != 0 ? info.transparent_page_size : DEFAULT_HUGE_PAGE_SIZE;
+
+        // Over-allocate, then trim so the region starts on a huge page boundary
+        const size_t mapped = alignedSize(_size, page_size);
+        const size_t reserved = mapped + page_size;
+        void* memory =
+            mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            return false;
+        }
+
+        const auto start = reinterpret_cast<uintptr_t>(memory);
+        const uintptr_t aligned = alignedAddress(start, page_size);
+        if (aligned != start) {
+            munmap(memory, aligned - start);
+        }
+        const size_t tail = start + reserved - (aligned + mapped);
+        if (tail != 0) {
+            munmap(reinterpret_cast<void*>(aligned + mapped), tail);
+        }
+
+        void* region = reinterpret_cast<void*>(aligned);
+        if (madvise(region, mapped, MADV_HUGEPAGE) != 0) {
+            munmap(region, mapped);
+            return false;
+        }
+        adopt(region, mapped, page_size, HugePageBacking::transparent);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void mapNormal() {
+        const size_t page_size = getRuntimePageSize();
+        const size_t mapped = alignedSize(_size, page_size);
+#if defined(__unix__) || defined(__APPLE__)
+        void* memory =
+            mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#else
+        // operator new does not zero memory like anonymous mappings do
+        void* memory = ::operator new(mapped, std::align_val_t(alignof(PageAligned)));
+        std::fill_n(static_cast<unsigned char*>(memory), mapped, static_cast<unsigned char>(0));
+#endif
+        adopt(memory, mapped, page_size, HugePageBacking::normal);
+    }
+
+    void adopt(void* memory, size_t mapped, size_t page_size, HugePageBacking backing) noexcept {
+        _data = memory;
+        _mapped_size = mapped;
+        _page_size = page_size;
+        _backing = backing;
+    }
+
+    void release() noexcept {
+        if (_data == nullptr) {
+            return;
+        }
+#if defined(__unix__) || defined(__APPLE__)
+        munmap(_data, _mapped_size);
+#else
+        ::operator delete(_data, std::align_val_t(alignof(PageAligned)));
+#endif
+        _data = nullptr;
+    }
+
+    void* _data = nullptr;
+    size_t _size = 0;
+    size_t _mapped_size = 0;
+    size_t _page_size = 0;
+    HugePageBacking _backing = HugePageBacking::none;
+};
+
+}  // namespace platform
+}  // namespace trlc
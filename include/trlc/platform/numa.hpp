@@ -0,0 +1,336 @@
+#pragma once
+
+/**
+ * @file numa.hpp
+ * @brief NUMA-aware memory allocation and first-touch initialization
+ *
+ * On multi-socket systems memory attached to a remote node costs extra
+ * latency and shares the interconnect. The functions here place anonymous
+ * mappings on a chosen node or interleave them across all nodes using the
+ * Linux mbind/get_mempolicy system calls directly, so no libnuma is
+ * required. On single-node machines, or where the kernel refuses memory
+ * policies, they fall back to ordinary page-aligned allocations.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "trlc/platform/affinity.hpp"
+#include "trlc/platform/detail/sysfs.hpp"
+#include "trlc/platform/memory.hpp"
+#include "trlc/platform/resources.hpp"
+#include "trlc/platform/topology.hpp"
+#include "trlc/platform/typeinfo.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/mman.h>
+#endif
+
+#if defined(__linux__)
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace trlc {
+namespace platform {
+
+namespace detail {
+
+// Memory policy modes and flags from <linux/mempolicy.h>
+constexpr int NUMA_MPOL_BIND = 2;
+constexpr int NUMA_MPOL_INTERLEAVE = 3;
+constexpr unsigned long NUMA_MPOL_F_NODE = 1ul << 0;
+constexpr unsigned long NUMA_MPOL_F_ADDR = 1ul << 1;
+
+/// Largest node ID representable in the masks passed to the kernel
+constexpr int NUMA_MAX_NODE = 1023;
+constexpr size_t NUMA_MASK_WORDS = (NUMA_MAX_NODE + 1) / (8 * sizeof(unsigned long));
+
+/**
+ * @brief Apply a memory policy to an address range with mbind(2)
+ * @param address Page-aligned start of the range
+ * @param bytes Length of the range
+ * @param mode Policy mode (NUMA_MPOL_*)
+ * @param nodes Nodes the policy refers to
+ * @return true if the kernel accepted the policy
+ */
+inline bool applyMemoryPolicy(void* address,
+                              size_t bytes,
+                              int mode,
+                              const std::vector<int>& nodes) noexcept {
+#if defined(__linux__) && defined(SYS_mbind)
+    unsigned long mask[NUMA_MASK_WORDS] = {};
+    constexpr size_t word_bits = 8 * sizeof(unsigned long);
+    for (int node : nodes) {
+        if (node < 0 || node > NUMA_MAX_NODE) {
+            return false;
+        }
+        mask[node / word_bits] |= 1ul << (node % word_bits);
+    }
+    return syscall(SYS_mbind, address, bytes, mode, mask, NUMA_MAX_NODE + 1, 0) == 0;
+#else
+    static_cast<void>(address);
+    static_cast<void>(bytes);
+    static_cast<void>(mode);
+    static_cast<void>(nodes);
+    return false;
+#endif
+}
+
+/**
+ * @brief Map anonymous, page-aligned memory
+ * @param bytes Size, already rounded to whole pages
+ * @return Mapping, or nullptr on failure
+ */
+inline void* mapAnonymousPages(size_t bytes) noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+    void* memory =
+        mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return memory == MAP_FAILED ? nullptr : memory;
+#else
+    return ::operator new(bytes, std::align_val_t(getRuntimePageSize()), std::nothrow);
+#endif
+}
+
+/**
+ * @brief Release memory obtained from mapAnonymousPages()
+ * @param memory Mapping
+ * @param bytes Size passed to mapAnonymousPages()
+ */
+inline void unmapAnonymousPages(void* memory, size_t bytes) noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+    munmap(memory, bytes);
+#else
+    static_cast<void>(bytes);
+    ::operator delete(memory, std::align_val_t(getRuntimePageSize()));
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief NUMA configuration of the running system
+ */
+struct NumaInfo {
+    std::vector<int> nodes;  ///< Online NUMA node IDs, including memory-only nodes
+    bool policy_supported;   ///< true if the kernel accepts memory policy calls
+
+    /// @return Number of online nodes (at least 1)
+    size_t nodeCount() const noexcept { return std::max<size_t>(nodes.size(), 1); }
+
+    /**
+     * @brief Check whether node placement has any effect
+     * @return true on multi-node systems that accept memory policies
+     */
+    bool isNuma() const noexcept { return nodes.size() > 1 && policy_supported; }
+};
+
+/**
+ * @brief Get the NUMA configuration read at first use
+ * @return Cached NUMA information
+ */
+inline const NumaInfo& getNumaInfo() {
+    static const NumaInfo info = [] {
+        NumaInfo result{{}, false};
+        std::string text;
+        if (detail::readFirstLine("/sys/devices/system/node/online", text)) {
+            result.nodes = detail::parseCpuList(text);
+        }
+        if (result.nodes.empty()) {
+            result.nodes.push_back(0);
+        }
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+        // Containers may filter these calls; probe before relying on them
+        int mode = 0;
+        result.policy_supported =
+            syscall(SYS_get_mempolicy, &mode, nullptr, 0, nullptr, 0ul) == 0;
+#endif
+        return result;
+    }();
+    return info;
+}
+
+/**
+ * @brief Allocate memory bound to one NUMA node
+ *
+ * The size is rounded up to whole pages. With a strict binding the kernel
+ * does not fall back to other nodes, so the node must have enough free
+ * memory. On single-node systems, and where the kernel refuses memory
+ * policies altogether (see NumaInfo::policy_supported), an ordinary
+ * page-aligned mapping is returned.
+ *
+ * @param bytes Size in bytes
+ * @param node NUMA node ID
+ * @return Page-aligned memory, or nullptr on failure, if @p node is not an
+ *         online node, or if the kernel rejects the binding; release it
+ *         with deallocateNuma() and the same size
+ */
+inline void* allocateOnNode(size_t bytes, int node) {
+    const NumaInfo& numa = getNumaInfo();
+    if (std::find(numa.nodes.begin(), numa.nodes.end(), node) == numa.nodes.end()) {
+        return nullptr;
+    }
+    const size_t size = alignedSize(std::max<size_t>(bytes, 1), getRuntimePageSize());
+    void* memory = detail::mapAnonymousPages(size);
+    if (memory != nullptr && numa.isNuma() &&
+        !detail::applyMemoryPolicy(memory, size, detail::NUMA_MPOL_BIND, std::vector<int>{node})) {
+        detail::unmapAnonymousPages(memory, size);
+        return nullptr;
+    }
+    return memory;
+}
+
+/**
+ * @brief Allocate memory interleaved page by page across all nodes
+ *
+ * Spreads bandwidth-bound shared data evenly over the memory controllers.
+ * On single-node systems, and where the kernel refuses memory policies
+ * altogether, an ordinary page-aligned mapping is returned.
+ *
+ * @param bytes Size in bytes
+ * @return Page-aligned memory, or nullptr on failure or if the kernel
+ *         rejects the policy; release it with deallocateNuma() and the
+ *         same size
+ */
+inline void* allocateInterleaved(size_t bytes) {
+    const size_t size = alignedSize(std::max<size_t>(bytes, 1), getRuntimePageSize());
+    void* memory = detail::mapAnonymousPages(size);
+    const NumaInfo& numa = getNumaInfo();
+    if (memory != nullptr && numa.isNuma() &&
+        !detail::applyMemoryPolicy(memory, size, detail::NUMA_MPOL_INTERLEAVE, numa.nodes)) {
+        detail::unmapAnonymousPages(memory, size);
+        return nullptr;
+    }
+    return memory;
+}
+
+/**
+ * @brief Release memory from allocateOnNode() or allocateInterleaved()
+ * @param memory Allocation (nullptr is ignored)
+ * @param bytes Size passed to the allocation function
+ */
+inline void deallocateNuma(void* memory, size_t bytes) noexcept {
+    if (memory != nullptr) {
+        detail::unmapAnonymousPages(
+            memory, alignedSize(std::max<size_t>(bytes, 1), getRuntimePageSize()));
+    }
+}
+
+/**
+ * @brief Get the NUMA node a page currently resides on
+ * @param address Address within a page that has been touched
+ * @return Node ID, or -1 if unknown
+ */
+inline int getMemoryNode(const void* address) noexcept {
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+    int node = -1;
+    if (syscall(SYS_get_mempolicy,
+                &node,
+                nullptr,
+                0ul,
+                address,
+                detail::NUMA_MPOL_F_NODE | detail::NUMA_MPOL_F_ADDR) == 0) {
+        return node;
+    }
+#else
+    static_cast<void>(address);
+#endif
+    return -1;
+}
+
+/**
+ * @brief Zero memory from threads running on a NUMA node
+ *
+ * Under the default local-allocation policy a page is placed on the node
+ * of the thread that first writes it. Splitting the range at page boundaries
+ * into slices written by threads pinned to @p node therefore places all
+ * pages there and faults them in parallel; @p memory need not be aligned.
+ * Threads that cannot be pinned still initialize their slice, and slices of
+ * threads that cannot be started are initialized by the calling thread.
+ *
+ * @param memory Start of the range
+ * @param bytes Length of the range
+ * @param node NUMA node ID
+ * @param thread_count Threads to use; 0 for the node's CPUs within the
+ *        process CPU budget
+ */
+inline void firstTouchOnNode(void* memory, size_t bytes, int node, size_t thread_count = 0) {
+    if (memory == nullptr || bytes == 0) {
+        return;
+    }
+
+    const size_t page_size = getRuntimePageSize();
+    if (thread_count == 0) {
+        thread_count = std::min(getCpuTopology().cpusInNode(node).size(), getEffectiveCpuCount());
+    }
+
+    // Slices start on page boundaries of the address, so no page is shared
+    const auto begin = reinterpret_cast<uintptr_t>(memory);
+    const uintptr_t end = begin + bytes;
+    const uintptr_t first_page = alignedAddress(begin + 1, page_size) - page_size;
+    const size_t pages = (alignedAddress(end, page_size) - first_page) / page_size;
+    thread_count = std::max<size_t>(std::min(thread_count, pages), 1);
+
+    auto touch = [=](size_t index, bool pin) {
+        if (pin) {
+            static_cast<void>(pinToNode(node));
+        }
+        const uintptr_t first =
+            std::max(first_page + index * pages / thread_count * page_size, begin);
+        const uintptr_t last =
+            std::min(first_page + (index + 1) * pages / thread_count * page_size, end);
+        std::memset(reinterpret_cast<void*>(first), 0, last - first);
+    };
+
+    // Started threads are joined on every exit path, including exceptions
+    struct Joiner {
+        std::vector<std::thread> threads;
+        ~Joiner() {
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }
+    } joiner;
+
+    size_t started = 1;
+    try {
+        joiner.threads.reserve(thread_count - 1);
+        for (; started < thread_count; ++started) {
+            joiner.threads.emplace_back(touch, started, true);
+        }
+    } catch (const std::exception&) {
+        // Out of threads or memory: the calling thread touches the remaining slices
+    }
+
+    // The calling thread takes the first slice and keeps its own affinity;
+    // if the affinity cannot be read it could not be restored, so the
+    // caller touches its slices without moving to the node
+    const std::vector<int> affinity = getCurrentThreadAffinity();
+    const bool pin = !affinity.empty();
+    try {
+        touch(0, pin);
+        for (size_t index = started; index < thread_count; ++index) {
+            touch(index, pin);
+        }
+    } catch (...) {
+        if (pin) {
+            static_cast<void>(pinCurrentThread(affinity));
+        }
+        throw;
+    }
+    if (pin) {
+        static_cast<void>(pinCurrentThread(affinity));
+    }
+}
+
+}  // namespace platform
+}  // namespace trlc
@@ -0,0 +1,453 @@
+#pragma once
+
+/**
+ * @file pool.hpp
+ * @brief Fixed-size object pool with per-thread caches
+ *
+ * Small objects of one size that are created and destroyed at a high rate,
+ * such as messages passed between threads, are served from cache-line
+ * aligned slabs. Every thread keeps a magazine of free slots, so the common
+ * allocate/deallocate pair touches no shared state. Objects freed by a
+ * thread other than the one owning their slab go to a lock-free shared free
+ * list, from which any thread refills its magazine.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "trlc/platform/allocator.hpp"
+#include "trlc/platform/macros.hpp"
+#include "trlc/platform/typeinfo.hpp"
+
+namespace trlc {
+namespace platform {
+
+/**
+ * @brief Instrumentation counters of a pool, summed over all threads
+ */
+struct PoolStats {
+    uint64_t hits;          ///< Allocations served from the thread's magazine
+    uint64_t refills;       ///< Magazine refills from the shared list or a new slab
+    uint64_t remote_frees;  ///< Objects freed by a thread not owning their slab
+    uint64_t flushes;       ///< Full magazines spilled to the shared list
+    size_t slab_count;      ///< Slabs allocated from the system
+    size_t thread_caches;   ///< Per-thread caches created so far
+
+    /// @return Fraction of allocations that did not leave the magazine
+    double hitRate() const noexcept {
+        const uint64_t allocations = hits + refills;
+        return allocations != 0 ? static_cast<double>(hits) / static_cast<double>(allocations)
+                                : 0.0;
+    }
+};
+
+namespace detail {
+
+/// Free slot, linked through its first bytes
+struct PoolNode {
+    PoolNode* next;
+};
+
+/// Header at the start of every slab
+struct PoolSlab {
+    PoolSlab* next;
+    size_t owner;  ///< Index of the thread cache that carved the slab
+};
+
+/// Number of free slots a thread keeps without touching shared state
+constexpr size_t POOL_MAGAZINE_SIZE = 64;
+
+/**
+ * @brief Free slots and counters of one thread for one pool
+ *
+ * Only the owning thread writes the fields; the counters are atomic so
+ * stats() can read them from other threads.
+ */
+struct TRLC_CACHE_ALIGNED PoolThreadCache {
+    void* magazine[POOL_MAGAZINE_SIZE];
+    size_t count = 0;
+    PoolNode* depot = nullptr;  ///< Further free slots taken in a refill
+    size_t index = 0;           ///< Owner ID written to slabs this cache carves
+    std::atomic<bool> in_use{true};
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> refills{0};
+    std::atomic<uint64_t> remote_frees{0};
+    std::atomic<uint64_t> flushes{0};
+};
+
+/// Increment a counter written by a single thread
+inline void bumpCounter(std::atomic<uint64_t>& counter) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// Pools currently alive; thread exit only touches caches of these
+inline std::mutex g_pool_registry_mutex;
+inline std::vector<uint64_t> g_live_pools;
+inline std::atomic<uint64_t> g_next_pool_id{1};
+
+inline bool isPoolAlive(uint64_t pool_id) {
+    return std::find(g_live_pools.begin(), g_live_pools.end(), pool_id) != g_live_pools.end();
+}
+
+/**
+ * @brief Caches the calling thread holds in each pool
+ *
+ * At thread exit the caches are handed back to their pools, so the next
+ * new thread adopts the free slots instead of stranding them.
+ */
+struct PoolThreadState {
+    struct Entry {
+        uint64_t pool_id;
+        PoolThreadCache* cache;
+    };
+
+    std::vector<Entry> entries;
+    uint64_t last_pool_id = 0;
+    PoolThreadCache* last_cache = nullptr;
+
+    PoolThreadState() = default;
+    PoolThreadState(const PoolThreadState&) = delete;
+    PoolThreadState& operator=(const PoolThreadState&) = delete;
+
+    ~PoolThreadState() {
+        std::lock_guard<std::mutex> lock(g_pool_registry_mutex);
+        for (const Entry& entry : entries) {
+            if (isPoolAlive(entry.pool_id)) {
+                entry.cache->in_use.store(false, std::memory_order_release);
+            }
+        }
+    }
+};
+
+inline PoolThreadState& poolThreadState() {
+    static thread_local PoolThreadState state;
+    return state;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Pool of equally sized, uninitialized memory blocks
+ *
+ * Blocks come from slabs aligned to their own size, which lets a
+ * deallocation find the slab owner with a mask. A thread allocates from
+ * its magazine and refills it from its depot, then from the shared free
+ * list, then by carving a new slab. Blocks of its own slabs go back into
+ * its magazine; when the magazine is full the older half is spilled to the
+ * shared list in one step. Blocks of other threads' slabs are pushed onto
+ * the shared list directly. The shared list is only ever pushed to or
+ * taken as a whole, so it needs no ABA protection.
+ *
+ * Slabs are returned to the system when the pool is destroyed; all blocks
+ * must have been deallocated or abandoned by then.
+ */
+class FixedSizePool {
+public:
+    /// Smallest slab size; larger objects get slabs holding at least 16 of them
+    static constexpr size_t MIN_SLAB_SIZE = size_t(64) << 10;
+
+    /**
+     * @brief Create a pool
+     * @param object_size Size of each block in bytes
+     * @param object_alignment Power-of-two alignment of each block
+     */
+    explicit FixedSizePool(size_t object_size,
+                           size_t object_alignment = alignof(std::max_align_t))
+        : _id(detail::g_next_pool_id.fetch_add(1, std::memory_order_relaxed)) {
+        const size_t alignment = std::max(object_alignment, alignof(detail::PoolNode));
+        _object_size = alignedSize(std::max(object_size, sizeof(detail::PoolNode)), alignment);
+        _first_offset = alignedSize(sizeof(detail::PoolSlab),
+                                    std::max(alignment, alignof(CacheLineAligned)));
+        _slab_size = MIN_SLAB_SIZE;
+        while (_slab_size < _first_offset + 16 * _object_size) {
+            _slab_size *= 2;
+        }
+        _slab_capacity = (_slab_size - _first_offset) / _object_size;
+
+        std::lock_guard<std::mutex> lock(detail::g_pool_registry_mutex);
+        detail::g_live_pools.push_back(_id);
+    }
+
+    ~FixedSizePool() {
+        {
+            std::lock_guard<std::mutex> lock(detail::g_pool_registry_mutex);
+            detail::g_live_pools.erase(
+                std::find(detail::g_live_pools.begin(), detail::g_live_pools.end(), _id));
+        }
+        for (detail::PoolSlab* slab = _slabs.load(); slab != nullptr;) {
+            detail::PoolSlab* next = slab->next;
+            detail::deallocateAligned(slab, _slab_size);
+            slab = next;
+        }
+    }
+
+    FixedSizePool(const FixedSizePool&) = delete;
+    FixedSizePool& operator=(const FixedSizePool&) = delete;
+
+    /**
+     * @brief Allocate one block
+     * @return Uninitialized block; throws std::bad_alloc on failure
+     */
+    void* allocate() {
+        detail::PoolThreadCache& cache = localCache();
+        if (TRLC_LIKELY(cache.count != 0)) {
+            detail::bumpCounter(cache.hits);
+            return cache.magazine[--cache.count];
+        }
+        return refill(cache);
+    }
+
+    /**
+     * @brief Return a block to the pool
+     * @param object Block from allocate() of this pool (nullptr is ignored)
+     */
+    void deallocate(void* object) noexcept {
+        if (object == nullptr) {
+            return;
+        }
+        auto* node = static_cast<detail::PoolNode*>(object);
+        detail::PoolThreadCache* cache = nullptr;
+        try {
+            cache = &localCache();
+        } catch (...) {
+            // No cache could be set up for this thread; the shared list takes the block
+            pushShared(node, node);
+            return;
+        }
+
+        if (slabOf(object)->owner != cache->index) {
+            detail::bumpCounter(cache->remote_frees);
+            pushShared(node, node);
+            return;
+        }
+        if (TRLC_UNLIKELY(cache->count == detail::POOL_MAGAZINE_SIZE)) {
+            flush(*cache);
+        }
+        cache->magazine[cache->count++] = object;
+    }
+
+    /// @return Size of each block in bytes, including padding
+    size_t objectSize() const noexcept { return _object_size; }
+
+    /// @return Size of each slab in bytes
+    size_t slabSize() const noexcept { return _slab_size; }
+
+    /// @return Blocks carved from each slab
+    size_t slabCapacity() const noexcept { return _slab_capacity; }
+
+    /**
+     * @brief Read the counters of all threads
+     * @return Counters summed over every thread cache
+     */
+    PoolStats stats() const {
+        PoolStats result{0, 0, 0, 0, _slab_count.load(std::memory_order_relaxed), 0};
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& cache : _caches) {
+            result.hits += cache->hits.load(std::memory_order_relaxed);
+            result.refills += cache->refills.load(std::memory_order_relaxed);
+            result.remote_frees += cache->remote_frees.load(std::memory_order_relaxed);
+            result.flushes += cache->flushes.load(std::memory_order_relaxed);
+        }
+        result.thread_caches = _caches.size();
+        return result;
+    }
+
+private:
+    detail::PoolThreadCache& localCache() {
+        detail::PoolThreadState& state = detail::poolThreadState();
+        if (TRLC_LIKELY(state.last_pool_id == _id)) {
+            return *state.last_cache;
+        }
+        return acquireCache(state);
+    }
+
+    TRLC_NEVER_INLINE detail::PoolThreadCache& acquireCache(detail::PoolThreadState& state) {
+        detail::PoolThreadCache* cache = nullptr;
+        for (const auto& entry : state.entries) {
+            if (entry.pool_id == _id) {
+                cache = entry.cache;
+                break;
+            }
+        }
+
+        if (cache == nullptr) {
+            std::lock_guard<std::mutex> registry_lock(detail::g_pool_registry_mutex);
+            // Forget caches of pools destroyed since this thread last used them
+            state.entries.erase(std::remove_if(state.entries.begin(),
+                                               state.entries.end(),
+                                               [](const detail::PoolThreadState::Entry& entry) {
+                                                   return !detail::isPoolAlive(entry.pool_id);
+                                               }),
+                                state.entries.end());
+            state.entries.reserve(state.entries.size() + 1);
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (const auto& candidate : _caches) {
+                if (!candidate->in_use.load(std::memory_order_acquire)) {
+                    candidate->in_use.store(true, std::memory_order_relaxed);
+                    cache = candidate.get();
+                    break;
+                }
+            }
+            if (cache == nullptr) {
+                _caches.reserve(_caches.size() + 1);
+                _caches.push_back(std::make_unique<detail::PoolThreadCache>());
+                cache = _caches.back().get();
+                cache->index = _caches.size() - 1;
+            }
+            state.entries.push_back(detail::PoolThreadState::Entry{_id, cache});
+        }
+
+        state.last_pool_id = _id;
+        state.last_cache = cache;
+        return *cache;
+    }
+
+    TRLC_NEVER_INLINE void* refill(detail::PoolThreadCache& cache) {
+        detail::bumpCounter(cache.refills);
+        if (cache.depot == nullptr) {
+            cache.depot = _shared.exchange(nullptr, std::memory_order_acquire);
+        }
+        if (cache.depot == nullptr) {
+            carveSlab(cache);
+        }
+
+        // Leave half the magazine free for the deallocations that follow
+        while (cache.count < detail::POOL_MAGAZINE_SIZE / 2 && cache.depot != nullptr) {
+            detail::PoolNode* node = cache.depot;
+            cache.depot = node->next;
+            cache.magazine[cache.count++] = node;
+        }
+        return cache.magazine[--cache.count];
+    }
+
+    void carveSlab(detail::PoolThreadCache& cache) {
+        auto* slab =
+            static_cast<detail::PoolSlab*>(detail::allocateAligned(_slab_size, _slab_size));
+        slab->owner = cache.index;
+        slab->next = _slabs.load(std::memory_order_relaxed);
+        while (!_slabs.compare_exchange_weak(slab->next, slab, std::memory_order_relaxed)) {
+        }
+        _slab_count.fetch_add(1, std::memory_order_relaxed);
+
+        // Link the slots in address order so the first allocations are adjacent
+        auto* first = reinterpret_cast<unsigned char*>(slab) + _first_offset;
+        detail::PoolNode* head = nullptr;
+        for (size_t i = _slab_capacity; i > 0; --i) {
+            auto* node = reinterpret_cast<detail::PoolNode*>(first + (i - 1) * _object_size);
+            node->next = head;
+            head = node;
+        }
+        cache.depot = head;
+    }
+
+    void flush(detail::PoolThreadCache& cache) noexcept {
+        detail::bumpCounter(cache.flushes);
+        constexpr size_t half = detail::POOL_MAGAZINE_SIZE / 2;
+        for (size_t i = 0; i + 1 < half; ++i) {
+            static_cast<detail::PoolNode*>(cache.magazine[i])->next =
+                static_cast<detail::PoolNode*>(cache.magazine[i + 1]);
+        }
+        pushShared(static_cast<detail::PoolNode*>(cache.magazine[0]),
+                   static_cast<detail::PoolNode*>(cache.magazine[half - 1]));
+        std::copy(cache.magazine + half, cache.magazine + cache.count, cache.magazine);
+        cache.count -= half;
+    }
+
+    /// Push a linked chain of blocks onto the shared free list
+    void pushShared(detail::PoolNode* first, detail::PoolNode* last) noexcept {
+        detail::PoolNode* head = _shared.load(std::memory_order_relaxed);
+        do {
+            last->next = head;
+        } while (!_shared.compare_exchange_weak(
+            head, first, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    const detail::PoolSlab* slabOf(const void* object) const noexcept {
+        return reinterpret_cast<const detail::PoolSlab*>(reinterpret_cast<uintptr_t>(object) &
+                                                         ~uintptr_t(_slab_size - 1));
+    }
+
+    // Shared free list on its own cache line, away from the read-only layout
+    TRLC_CACHE_ALIGNED std::atomic<detail::PoolNode*> _shared{nullptr};
+
+    TRLC_CACHE_ALIGNED uint64_t _id;
+    size_t _object_size;
+    size_t _first_offset;
+    size_t _slab_size;
+    size_t _slab_capacity;
+
+    std::atomic<detail::PoolSlab*> _slabs{nullptr};
+    std::atomic<size_t> _slab_count{0};
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<detail::PoolThreadCache>> _caches;
+};
+
+/**
+ * @brief Pool that constructs and destroys objects of one type
+ *
+ * @tparam Type Object type
+ *
+ * @example
+ * @code
+ * trlc::platform::ObjectPool<Message> messages;
+ * Message* message = messages.create(payload);
+ * queue.push(message);
+ * // On the consumer thread:
+ * messages.destroy(message);
+ * @endcode
+ */
+template <typename Type>
+class ObjectPool {
+public:
+    ObjectPool() : _pool(sizeof(Type), alignof(Type)) {}
+
+    /**
+     * @brief Construct an object in a pooled block
+     * @param args Constructor arguments
+     * @return New object; throws std::bad_alloc or what the constructor throws
+     */
+    template <typename... Args>
+    Type* create(Args&&... args) {
+        void* memory = _pool.allocate();
+        try {
+            return new (memory) Type(std::forward<Args>(args)...);
+        } catch (...) {
+            _pool.deallocate(memory);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Destroy an object from create() and return its block
+     * @param object Object (nullptr is ignored); may be destroyed on any thread
+     */
+    void destroy(Type* object) noexcept {
+        if (object != nullptr) {
+            object->~Type();
+            _pool.deallocate(object);
+        }
+    }
+
+    /// @return Counters summed over all threads
+    PoolStats stats() const { return _pool.stats(); }
+
+    /// @return Untyped pool providing the blocks
+    FixedSizePool& pool() noexcept { return _pool; }
+
+private:
+    FixedSizePool _pool;
+};
+
+}  // namespace platform
+}  // namespace trlc
@@ -0,0 +1,608 @@
+#pragma once
+
+/**
+ * @file resources.hpp
+ * @brief Container-aware CPU and memory budgets
+ *
+ * std::thread::hardware_concurrency() reports every CPU of the host, even
+ * when the process may only use a few of them. This header combines the
+ * scheduler affinity mask with Linux cgroup v1/v2 CPU quotas and cpusets
+ * into the number of CPUs the process can actually keep busy, which is the
+ * right size for worker pools inside containers. Likewise, the memory
+ * budget reports the cgroup memory limit instead of the host's RAM, so
+ * in-process caches can stay clear of the OOM killer.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "trlc/platform/detail/sysfs.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+    #include <sched.h>
+    #include <sys/sysinfo.h>
+#endif
+
+namespace trlc {
+namespace platform {
+
+//
+// Control groups
+//
+
+/**
+ * @brief Linux control group hierarchy a limit was read from
+ */
+enum class CgroupVersion : int {
+    none = 0,  ///< No cgroup controller found (not Linux, or not mounted)
+    v1,        ///< Legacy per-controller hierarchies
+    v2         ///< Unified hierarchy
+};
+
+/**
+ * @brief Get the display name of a cgroup version
+ * @param version Cgroup version
+ * @return "v1", "v2" or "none"
+ */
+constexpr const char* cgroupVersionName(CgroupVersion version) noexcept {
+    switch (version) {
+        case CgroupVersion::v1:
+            return "v1";
+        case CgroupVersion::v2:
+            return "v2";
+        default:
+            return "none";
+    }
+}
+
+namespace detail {
+
+/**
+ * @brief Location of one cgroup controller for the current process
+ */
+struct CgroupController {
+    CgroupVersion version;    ///< Hierarchy the controller belongs to
+    std::string mount_point;  ///< Where the hierarchy is mounted
+    std::string path;         ///< Directory of this process's cgroup
+};
+
+/**
+ * @brief Check whether a comma-separated list contains a word
+ * @param list List such as "rw,cpu,cpuacct"
+ * @param word Word to find
+ * @return true if @p word is one of the list entries
+ */
+inline bool listContains(const std::string& list, const std::string& word) {
+    size_t start = 0;
+    while (start <= list.size()) {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        if (list.compare(start, end - start, word) == 0) {
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+/**
+ * @brief Map a cgroup path to a directory below a mount point
+ *
+ * A hierarchy may be mounted from a subdirectory (@p root), as happens in
+ * containers without a cgroup namespace; that prefix is removed first.
+ *
+ * @param mount_point Mount point of the hierarchy
+ * @param root Root of the mount within the hierarchy
+ * @param path Cgroup path from /proc/self/cgroup
+ * @return Directory of the cgroup
+ */
+inline std::string resolveCgroupPath(const std::string& mount_point,
+                                     const std::string& root,
+                                     const std::string& path) {
+    std::string relative = path;
+    if (root != "/" && relative.compare(0, root.size(), root) == 0) {
+        relative = relative.substr(root.size());
+    } else if (root != "/") {
+        relative.clear();  // Cgroup lies outside the visible mount
+    }
+    if (relative == "/") {
+        relative.clear();
+    }
+    return mount_point + relative;
+}
+
+/**
+ * @brief Find the cgroup directory of a controller for this process
+ *
+ * Legacy v1 hierarchies take precedence, since on hybrid systems the
+ * unified hierarchy carries no controllers.
+ *
+ * @param controller Controller name such as "cpu", "cpuset" or "memory"
+ * @param cgroup_file Membership file, normally "/proc/self/cgroup"
+ * @param mountinfo_file Mount table, normally "/proc/self/mountinfo"
+ * @return Controller location; version is none if it was not found
+ */
+inline CgroupController findCgroupController(const std::string& controller,
+                                             const std::string& cgroup_file,
+                                             const std::string& mountinfo_file) {
+    // Membership lines are "<id>:<controllers>:<path>"; v2 uses "0::<path>"
+    std::string v1_path;
+    std::string v2_path;
+    forEachLine(cgroup_file, [&](const std::string& line) {
+        const size_t first = line.find(':');
+        const size_t second = line.find(':', first + 1);
+        if (first == std::string::npos || second == std::string::npos) {
+            return true;
+        }
+        const std::string controllers = line.substr(first + 1, second - first - 1);
+        if (controllers.empty()) {
+            v2_path = line.substr(second + 1);
+        } else if (listContains(controllers, controller)) {
+            v1_path = line.substr(second + 1);
+        }
+        return true;
+    });
+
+    // Mount lines are "<id> <parent> <dev> <root> <mount point> ... - <type> <source> <options>"
+    CgroupController v1{CgroupVersion::none, {}, {}};
+    CgroupController v2{CgroupVersion::none, {}, {}};
+    forEachLine(mountinfo_file, [&](const std::string& line) {
+        const size_t separator = line.find(" - ");
+        if (separator == std::string::npos) {
+            return true;
+        }
+
+        std::string fields[5];
+        size_t pos = 0;
+        for (std::string& field : fields) {
+            const size_t end = line.find(' ', pos);
+            field = line.substr(pos, end - pos);
+            pos = end == std::string::npos ? line.size() : end + 1;
+        }
+
+        const std::string tail = line.substr(separator + 3);
+        const size_t type_end = tail.find(' ');
+        const std::string type = tail.substr(0, type_end);
+        const size_t options_start = tail.find(' ', type_end + 1);
+        const std::string options =
+            options_start == std::string::npos ? std::string() : tail.substr(options_start + 1);
+
+        if (type == "cgroup" && !v1_path.empty() && listContains(options, controller)) {
+            v1 = {CgroupVersion::v1, fields[4], resolveCgroupPath(fields[4], fields[3], v1_path)};
+        } else if (type == "cgroup2" && !v2_path.empty()) {
+            v2 = {CgroupVersion::v2, fields[4], resolveCgroupPath(fields[4], fields[3], v2_path)};
+        }
+        return true;
+    });
+
+    return v1.version != CgroupVersion::none ? v1 : v2;
+}
+
+/**
+ * @brief Call a function for a cgroup directory and each of its ancestors
+ *
+ * Limits set on a parent cgroup also apply to its children, so the
+ * tightest limit on the way to the mount point is the effective one.
+ *
+ * @param controller Controller location
+ * @param callback Callable taking the directory as `const std::string&`
+ */
+template <typename Callback>
+void forEachCgroupLevel(const CgroupController& controller, Callback&& callback) {
+    std::string dir = controller.path;
+    while (true) {
+        callback(dir);
+        const size_t slash = dir.rfind('/');
+        if (dir.size() <= controller.mount_point.size() || slash == std::string::npos ||
+            slash < controller.mount_point.size()) {
+            break;
+        }
+        dir.resize(slash);
+    }
+}
+
+//
+// CPU limits
+//
+
+/**
+ * @brief Parse a cgroup v2 cpu.max value
+ * @param text Contents such as "max 100000" or "150000 100000"
+ * @return CPUs allowed by the quota, or 0 if unlimited
+ */
+inline double parseCpuMax(const std::string& text) noexcept {
+    uint64_t quota = 0;
+    size_t end = 0;
+    if (!parseUnsigned(text, quota, &end)) {
+        return 0.0;  // "max"
+    }
+    uint64_t period = 0;
+    if (!parseUnsigned(text.substr(end), period) || period == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(quota) / static_cast<double>(period);
+}
+
+/**
+ * @brief Read the tightest CPU quota of a cgroup and its ancestors
+ * @param controller Location of the cpu controller
+ * @return CPUs allowed by the quota, or 0 if unlimited
+ */
+inline double readCgroupCpuQuota(const CgroupController& controller) {
+    double limit = 0.0;
+    forEachCgroupLevel(controller, [&](const std::string& dir) {
+        double quota = 0.0;
+        if (controller.version == CgroupVersion::v2) {
+            std::string text;
+            if (readFirstLine(dir + "/cpu.max", text)) {
+                quota = parseCpuMax(text);
+            }
+        } else {
+            // cpu.cfs_quota_us is -1 when unlimited, which fails to parse
+            uint64_t quota_us = 0;
+            uint64_t period_us = 0;
+            if (readUnsigned(dir + "/cpu.cfs_quota_us", quota_us) &&
+                readUnsigned(dir + "/cpu.cfs_period_us", period_us) && period_us != 0) {
+                quota = static_cast<double>(quota_us) / static_cast<double>(period_us);
+            }
+        }
+        if (quota > 0.0 && (limit == 0.0 || quota < limit)) {
+            limit = quota;
+        }
+    });
+    return limit;
+}
+
+/**
+ * @brief Count the CPUs of a cgroup cpuset
+ * @param controller Location of the cpuset controller
+ * @return Number of CPUs, or 0 if no cpuset is configured
+ */
+inline size_t readCgroupCpusetSize(const CgroupController& controller) {
+    const char* const files[] = {
+        "/cpuset.cpus.effective", "/cpuset.effective_cpus", "/cpuset.cpus"};
+    for (const char* file : files) {
+        std::string text;
+        if (readFirstLine(controller.path + file, text) && !text.empty()) {
+            return parseCpuList(text).size();
+        }
+    }
+    return 0;
+}
+
+}  // namespace detail
+
+/**
+ * @brief CPUs available to this process and the limits that determine them
+ *
+ * Every limit is 0 when it is absent or cannot be read.
+ */
+struct CpuBudget {
+    size_t online_cpus;            ///< CPUs online in the system
+    size_t affinity_cpus;          ///< CPUs in the scheduler affinity mask
+    size_t cpuset_cpus;            ///< CPUs in the cgroup cpuset
+    double quota_cpus;             ///< CPU time allowed by the cgroup quota, in CPUs
+    CgroupVersion cgroup_version;  ///< Hierarchy the quota was read from
+    size_t effective_cpus;         ///< CPUs the process can keep busy (at least 1)
+
+    /**
+     * @brief Check whether the process is limited below the online CPUs
+     * @return true if affinity, cpuset or quota reduce the usable CPUs
+     */
+    bool isLimited() const noexcept { return effective_cpus < online_cpus; }
+};
+
+namespace detail {
+
+/**
+ * @brief Combine CPU limits into the effective CPU count
+ *
+ * Takes the smallest of the known CPU counts and rounds a fractional
+ * quota up, so a 1.5 CPU quota yields 2 threads that together use it.
+ *
+ * @param budget Budget with its limits populated
+ * @return Effective CPU count, at least 1
+ */
+inline size_t computeEffectiveCpus(const CpuBudget& budget) noexcept {
+    size_t effective = budget.online_cpus;
+    for (size_t limit : {budget.affinity_cpus, budget.cpuset_cpus}) {
+        if (limit != 0 && (effective == 0 || limit < effective)) {
+            effective = limit;
+        }
+    }
+    if (budget.quota_cpus > 0.0) {
+        const auto quota = static_cast<size_t>(std::ceil(budget.quota_cpus));
+        if (effective == 0 || quota < effective) {
+            effective = quota;
+        }
+    }
+    return std::max<size_t>(effective, 1);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Read the current CPU budget of this process
+ *
+ * Every call reads the affinity mask and cgroup files again. Use
+ * getCpuBudget() or getEffectiveCpuCount() for the cached result.
+ *
+ * @return CPU budget
+ */
+inline CpuBudget readCpuBudget() {
+    CpuBudget budget{0, 0, 0, 0.0, CgroupVersion::none, 0};
+
+#if defined(__unix__) || defined(__APPLE__)
+    const long online = sysconf(_SC_NPROCESSORS_ONLN);
+    budget.online_cpus = online > 0 ? static_cast<size_t>(online) : 0;
+#endif
+    if (budget.online_cpus == 0) {
+        budget.online_cpus = std::thread::hardware_concurrency();
+    }
+
+#if defined(__linux__)
+    cpu_set_t mask;
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        budget.affinity_cpus = static_cast<size_t>(CPU_COUNT(&mask));
+    }
+
+    const detail::CgroupController cpu =
+        detail::findCgroupController("cpu", "/proc/self/cgroup", "/proc/self/mountinfo");
+    if (cpu.version != CgroupVersion::none) {
+        budget.quota_cpus = detail::readCgroupCpuQuota(cpu);
+        budget.cgroup_version = cpu.version;
+    }
+
+    const detail::CgroupController cpuset =
+        detail::findCgroupController("cpuset", "/proc/self/cgroup", "/proc/self/mountinfo");
+    if (cpuset.version != CgroupVersion::none) {
+        budget.cpuset_cpus = detail::readCgroupCpusetSize(cpuset);
+    }
+#endif
+
+    budget.effective_cpus = detail::computeEffectiveCpus(budget);
+    return budget;
+}
+
+namespace detail {
+/// Cached CPU budget (effective_cpus is 0 until first read)
+inline CpuBudget g_cpu_budget{0, 0, 0, 0.0, CgroupVersion::none, 0};
+inline std::mutex g_cpu_budget_mutex;
+
+/// Cached effective CPU count for lock-free reads (0 until first read)
+inline std::atomic<size_t> g_effective_cpu_count{0};
+}  // namespace detail
+
+/**
+ * @brief Get the cached CPU budget of this process
+ *
+ * Read on first use. Pass @p refresh after the container has been resized
+ * or the affinity mask changed to read the limits again and update the
+ * cache for later calls.
+ *
+ * @param refresh Read the limits again instead of using the cache
+ * @return CPU budget
+ */
+inline CpuBudget getCpuBudget(bool refresh = false) {
+    std::lock_guard<std::mutex> lock(detail::g_cpu_budget_mutex);
+    if (refresh || detail::g_cpu_budget.effective_cpus == 0) {
+        detail::g_cpu_budget = readCpuBudget();
+        detail::g_effective_cpu_count.store(detail::g_cpu_budget.effective_cpus,
+                                            std::memory_order_relaxed);
+    }
+    return detail::g_cpu_budget;
+}
+
+/**
+ * @brief Get the number of CPUs this process can keep busy
+ *
+ * Unlike std::thread::hardware_concurrency(), this honors the affinity
+ * mask and container CPU limits. After the first call the cached value is
+ * returned without locking.
+ *
+ * @param refresh Read the limits again instead of using the cache
+ * @return Effective CPU count, at least 1
+ *
+ * @example
+ * @code
+ * std::vector<std::thread> workers(trlc::platform::getEffectiveCpuCount());
+ * @endcode
+ */
+inline size_t getEffectiveCpuCount(bool refresh = false) {
+    if (!refresh) {
+        const size_t count = detail::g_effective_cpu_count.load(std::memory_order_relaxed);
+        if (count != 0) {
+            return count;
+        }
+    }
+    return getCpuBudget(refresh).effective_cpus;
+}
+
+//
+// Memory limits
+//
+
+namespace detail {
+
+/**
+ * @brief Read the tightest byte limit of a cgroup and its ancestors
+ *
+ * Values that do not parse ("max") or that are not below @p unlimited
+ * (cgroup v1 reports "no limit" as a huge page-aligned number) are ignored.
+ *
+ * @param controller Location of the memory controller
+ * @param file Limit file name, such as "/memory.max"
+ * @param unlimited Smallest value treated as no limit (0 for none)
+ * @return Limit in bytes, or 0 if unlimited
+ */
+inline uint64_t readCgroupByteLimit(const CgroupController& controller,
+                                    const char* file,
+                                    uint64_t unlimited) {
+    uint64_t limit = 0;
+    forEachCgroupLevel(controller, [&](const std::string& dir) {
+        uint64_t value = 0;
+        if (!readUnsigned(dir + file, value) || (unlimited != 0 && value >= unlimited)) {
+            return;
+        }
+        if (limit == 0 || value < limit) {
+            limit = value;
+        }
+    });
+    return limit;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Memory available to this process and the limits that determine it
+ *
+ * Every limit is 0 when it is absent or cannot be read.
+ */
+struct MemoryBudget {
+    uint64_t physical_bytes;       ///< Physical memory of the system
+    uint64_t limit_bytes;          ///< Hard cgroup limit (memory.max, memory.limit_in_bytes)
+    uint64_t high_bytes;           ///< cgroup v2 throttling threshold (memory.high)
+    uint64_t usage_bytes;          ///< Current cgroup usage, or system-wide use without one
+    CgroupVersion cgroup_version;  ///< Hierarchy the limits were read from
+    uint64_t effective_bytes;      ///< Smallest of the physical memory and the limits
+
+    /**
+     * @brief Memory that can still be used before reaching the budget
+     * @return effective_bytes minus usage_bytes, or 0 if already exceeded
+     */
+    uint64_t availableBytes() const noexcept {
+        return effective_bytes > usage_bytes ? effective_bytes - usage_bytes : 0;
+    }
+
+    /**
+     * @brief Check whether a cgroup limits memory below the physical size
+     * @return true if a limit is smaller than the physical memory
+     */
+    bool isLimited() const noexcept { return effective_bytes < physical_bytes; }
+};
+
+/**
+ * @brief Read the current memory budget of this process
+ *
+ * Limits come from the cgroup memory controller; without one, the budget
+ * is the physical memory from sysinfo() and the usage is system-wide.
+ * Usage under cgroup v1 includes page cache the kernel can reclaim.
+ * Every call reads the files again, so the usage is current.
+ *
+ * @return Memory budget
+ *
+ * @example
+ * @code
+ * auto budget = trlc::platform::readMemoryBudget();
+ * size_t cache_bytes = budget.effective_bytes / 4;  // Leave room for the rest
+ * @endcode
+ */
+inline MemoryBudget readMemoryBudget() {
+    MemoryBudget budget{0, 0, 0, 0, CgroupVersion::none, 0};
+
+#if defined(__linux__)
+    struct sysinfo info;
+    if (sysinfo(&info) == 0) {
+        const uint64_t unit = info.mem_unit != 0 ? info.mem_unit : 1;
+        budget.physical_bytes = static_cast<uint64_t>(info.totalram) * unit;
+        budget.usage_bytes =
+            static_cast<uint64_t>(info.totalram - info.freeram - info.bufferram) * unit;
+    }
+
+    const detail::CgroupController memory =
+        detail::findCgroupController("memory", "/proc/self/cgroup", "/proc/self/mountinfo");
+    if (memory.version == CgroupVersion::v2) {
+        budget.limit_bytes = detail::readCgroupByteLimit(memory, "/memory.max", 0);
+        budget.high_bytes = detail::readCgroupByteLimit(memory, "/memory.high", 0);
+        detail::readUnsigned(memory.path + "/memory.current", budget.usage_bytes);
+        budget.cgroup_version = memory.version;
+    } else if (memory.version == CgroupVersion::v1) {
+        budget.limit_bytes =
+            detail::readCgroupByteLimit(memory, "/memory.limit_in_bytes", budget.physical_bytes);
+        detail::readUnsigned(memory.path + "/memory.usage_in_bytes", budget.usage_bytes);
+        budget.cgroup_version = memory.version;
+    }
+#elif defined(_SC_PHYS_PAGES) && defined(_SC_PAGESIZE)
+    const long pages = sysconf(_SC_PHYS_PAGES);
+    const long page_size = sysconf(_SC_PAGESIZE);
+    if (pages > 0 && page_size > 0) {
+        budget.physical_bytes = static_cast<uint64_t>(pages) * static_cast<uint64_t>(page_size);
+    }
+#endif
+
+    budget.effective_bytes = budget.physical_bytes;
+    for (uint64_t limit : {budget.limit_bytes, budget.high_bytes}) {
+        if (limit != 0 && (budget.effective_bytes == 0 || limit < budget.effective_bytes)) {
+            budget.effective_bytes = limit;
+        }
+    }
+    return budget;
+}
+
+namespace detail {
+/// Cached memory budget (effective_bytes is 0 until first read)
+inline MemoryBudget g_memory_budget{0, 0, 0, 0, CgroupVersion::none, 0};
+inline std::mutex g_memory_budget_mutex;
+
+/// Cached effective memory limit (0 until first read)
+inline std::atomic<uint64_t> g_effective_memory_bytes{0};
+}  // namespace detail
+
+/**
+ * @brief Get the memory budget of this process
+ *
+ * Read on first use and cached, so repeated calls agree with each other
+ * and with getEffectiveMemoryLimit(). The cached usage_bytes is the usage
+ * at the time of the read; call readMemoryBudget() for the current usage,
+ * or pass @p refresh to read the limits again and update the cache.
+ *
+ * @param refresh Read the limits again instead of using the cache
+ * @return Memory budget
+ */
+inline MemoryBudget getMemoryBudget(bool refresh = false) {
+    std::lock_guard<std::mutex> lock(detail::g_memory_budget_mutex);
+    if (refresh || detail::g_memory_budget.effective_bytes == 0) {
+        detail::g_memory_budget = readMemoryBudget();
+        detail::g_effective_memory_bytes.store(detail::g_memory_budget.effective_bytes,
+                                               std::memory_order_relaxed);
+    }
+    return detail::g_memory_budget;
+}
+
+/**
+ * @brief Get the amount of memory this process may use
+ *
+ * Read on first use and cached; pass @p refresh to read the limits again.
+ * After the first call the cached value is returned without locking.
+ * Call readMemoryBudget() for the current usage.
+ *
+ * @param refresh Read the limits again instead of using the cache
+ * @return Effective memory limit in bytes, or 0 if unknown
+ */
+inline uint64_t getEffectiveMemoryLimit(bool refresh = false) {
+    if (!refresh) {
+        const uint64_t bytes = detail::g_effective_memory_bytes.load(std::memory_order_relaxed);
+        if (bytes != 0) {
+            return bytes;
+        }
+    }
+    return getMemoryBudget(refresh).effective_bytes;
+}
+
+}  // namespace platform
+}  // namespace trlc
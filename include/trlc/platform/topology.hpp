@@ -0,0 +1,997 @@
+#pragma once
+
+/**
+ * @file topology.hpp
+ * @brief Runtime discovery of the CPU cache hierarchy and processor topology
+ *
+ * The compile-time cache line size in ArchitectureInfo is a per-architecture
+ * estimate. This header asks the running system instead: sysfs on Linux,
+ * CPUID leaf 4 (Intel) or 0x8000001D (AMD) on other x86 systems and sysctl
+ * on macOS. The processor topology maps every logical CPU to its core,
+ * package and NUMA node, from sysfs or, failing that, CPUID leaf 0x1F/0xB,
+ * and tells performance cores from efficiency cores on hybrid processors.
+ * Results are detected once and cached for the lifetime of the process.
+ *
+ * @copyright Copyright (c) 2025 TRLC Platform
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "trlc/platform/detail/sysfs.hpp"
+#include "trlc/platform/features.hpp"
+
+#if defined(__APPLE__)
+    #include <sys/sysctl.h>
+    #include <sys/types.h>
+#endif
+
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+namespace trlc {
+namespace platform {
+
+//
+// Cache hierarchy
+//
+
+/**
+ * @brief Kind of data a cache holds
+ */
+enum class CacheType : int {
+    unknown = 0,  ///< Type could not be determined
+    data,         ///< Data cache
+    instruction,  ///< Instruction cache
+    unified       ///< Unified data and instruction cache
+};
+
+/**
+ * @brief Description of one cache in the hierarchy
+ */
+struct CacheInfo {
+    int level;                  ///< Cache level (1 = L1)
+    CacheType type;             ///< Data, instruction or unified
+    size_t size_bytes;          ///< Total capacity in bytes
+    size_t line_size;           ///< Coherency line size in bytes
+    unsigned associativity;     ///< Ways of associativity (0 = unknown or fully associative)
+    unsigned shared_cpu_count;  ///< Logical CPUs sharing this cache (0 = unknown)
+};
+
+/**
+ * @brief Cache hierarchy of the CPU the process runs on
+ *
+ * Describes the caches seen by the first logical CPU. On x86 the sharing
+ * count from CPUID is the number of addressable IDs, an upper bound on the
+ * logical CPUs that actually share the cache; sysfs reports the exact set.
+ */
+struct CacheTopology {
+    std::vector<CacheInfo> caches;  ///< Caches ordered by level, L1d before L1i
+
+    /**
+     * @brief Find a cache by level and type
+     * @param level Cache level (1 = L1)
+     * @param type Cache type; data and instruction lookups also match unified caches
+     * @return Pointer to the cache, or nullptr if it is not present
+     */
+    const CacheInfo* find(int level, CacheType type) const noexcept {
+        const CacheInfo* unified = nullptr;
+        for (const CacheInfo& cache : caches) {
+            if (cache.level != level) {
+                continue;
+            }
+            if (cache.type == type) {
+                return &cache;
+            }
+            if (cache.type == CacheType::unified) {
+                unified = &cache;
+            }
+        }
+        return unified;
+    }
+
+    /// @return L1 data cache size in bytes, or 0 if unknown
+    size_t l1DataSize() const noexcept { return sizeOf(1, CacheType::data); }
+
+    /// @return L1 instruction cache size in bytes, or 0 if unknown
+    size_t l1InstructionSize() const noexcept { return sizeOf(1, CacheType::instruction); }
+
+    /// @return L2 cache size in bytes, or 0 if unknown
+    size_t l2Size() const noexcept { return sizeOf(2, CacheType::unified); }
+
+    /// @return L3 cache size in bytes, or 0 if there is none
+    size_t l3Size() const noexcept { return sizeOf(3, CacheType::unified); }
+
+    /**
+     * @brief Get the cache line size of the L1 data cache
+     * @return Line size in bytes, or 0 if no cache was detected
+     */
+    size_t lineSize() const noexcept {
+        const CacheInfo* cache = find(1, CacheType::data);
+        return cache != nullptr ? cache->line_size : 0;
+    }
+
+    /**
+     * @brief Check whether any cache information was detected
+     * @return true if at least one cache is described
+     */
+    bool isDetected() const noexcept { return !caches.empty(); }
+
+private:
+    size_t sizeOf(int level, CacheType type) const noexcept {
+        const CacheInfo* cache = find(level, type);
+        return cache != nullptr ? cache->size_bytes : 0;
+    }
+};
+
+/**
+ * @brief Get the display name of a cache
+ * @param cache Cache description
+ * @return Name such as "L1d", "L1i" or "L3"
+ */
+inline std::string cacheName(const CacheInfo& cache) {
+    std::string name = "L" + std::to_string(cache.level);
+    if (cache.type == CacheType::data) {
+        name += 'd';
+    } else if (cache.type == CacheType::instruction) {
+        name += 'i';
+    }
+    return name;
+}
+
+namespace detail {
+
+/**
+ * @brief Sort caches by level with data caches before instruction caches
+ * @param caches Caches to order in place
+ */
+inline void sortCaches(std::vector<CacheInfo>& caches) {
+    std::sort(caches.begin(), caches.end(), [](const CacheInfo& lhs, const CacheInfo& rhs) {
+        return lhs.level != rhs.level ? lhs.level < rhs.level
+                                      : static_cast<int>(lhs.type) < static_cast<int>(rhs.type);
+    });
+}
+
+#if TRLC_HAS_X86_INTRINSICS
+
+/**
+ * @brief Enumerate caches with the deterministic cache parameters leaf
+ *
+ * Leaf 4 (Intel) and leaf 0x8000001D (AMD) share one layout: every subleaf
+ * describes one cache until a subleaf reports type 0.
+ *
+ * @param leaf 4 or 0x8000001D
+ * @return Caches reported by the leaf
+ */
+inline std::vector<CacheInfo> detectCachesFromCpuid(uint32_t leaf) {
+    std::vector<CacheInfo> caches;
+    for (uint32_t subleaf = 0; subleaf < 16; ++subleaf) {
+        uint32_t regs[4];
+        cpuid(leaf, subleaf, regs);
+
+        const uint32_t type = regs[0] & 0x1F;  // EAX[4:0]
+        if (type == 0) {
+            break;
+        }
+
+        CacheInfo cache{};
+        cache.level = static_cast<int>((regs[0] >> 5) & 0x7);  // EAX[7:5]
+        cache.type = type == 1   ? CacheType::data
+                     : type == 2 ? CacheType::instruction
+                     : type == 3 ? CacheType::unified
+                                 : CacheType::unknown;
+
+        const size_t line_size = (regs[1] & 0xFFF) + 1;              // EBX[11:0]
+        const size_t partitions = ((regs[1] >> 12) & 0x3FF) + 1;     // EBX[21:12]
+        const size_t ways = ((regs[1] >> 22) & 0x3FF) + 1;           // EBX[31:22]
+        const size_t sets = static_cast<size_t>(regs[2]) + 1;        // ECX
+        const bool fully_associative = (regs[0] & (1u << 9)) != 0;  // EAX bit 9
+
+        cache.size_bytes = ways * partitions * line_size * sets;
+        cache.line_size = line_size;
+        cache.associativity = fully_associative ? 0 : static_cast<unsigned>(ways);
+        cache.shared_cpu_count = ((regs[0] >> 14) & 0xFFF) + 1;  // EAX[25:14]
+        caches.push_back(cache);
+    }
+    return caches;
+}
+
+/**
+ * @brief Detect the cache hierarchy through CPUID
+ * @return Caches, or an empty list if the CPU has no cache parameters leaf
+ */
+inline std::vector<CacheInfo> detectCachesX86() {
+    uint32_t regs[4];
+    cpuid(0x80000000u, 0, regs);
+    const uint32_t max_ext_leaf = regs[0];
+
+    // AMD reports caches in 0x8000001D when TopologyExtensions is set
+    if (max_ext_leaf >= 0x8000001Du && checkCpuFeature(0x80000001u, 0, 2, 22)) {
+        std::vector<CacheInfo> caches = detectCachesFromCpuid(0x8000001Du);
+        if (!caches.empty()) {
+            return caches;
+        }
+    }
+
+    cpuid(0, 0, regs);
+    if (regs[0] >= 4) {
+        return detectCachesFromCpuid(4);
+    }
+    return {};
+}
+
+#endif  // TRLC_HAS_X86_INTRINSICS
+
+/**
+ * @brief Detect the cache hierarchy of one CPU from sysfs
+ * @param cpu_root Directory of the CPU, e.g. "/sys/devices/system/cpu/cpu0"
+ * @return Caches, or an empty list if the directory does not exist
+ */
+inline std::vector<CacheInfo> detectCachesFromSysfs(const std::string& cpu_root) {
+    std::vector<CacheInfo> caches;
+    for (int index = 0; index < 16; ++index) {
+        const std::string dir = cpu_root + "/cache/index" + std::to_string(index) + "/";
+
+        uint64_t level = 0;
+        if (!readUnsigned(dir + "level", level)) {
+            break;
+        }
+
+        CacheInfo cache{};
+        cache.level = static_cast<int>(level);
+
+        std::string text;
+        if (readFirstLine(dir + "type", text)) {
+            cache.type = text == "Data"          ? CacheType::data
+                         : text == "Instruction" ? CacheType::instruction
+                         : text == "Unified"     ? CacheType::unified
+                                                 : CacheType::unknown;
+        }
+        if (readFirstLine(dir + "size", text)) {
+            cache.size_bytes = static_cast<size_t>(parseSizeWithSuffix(text));
+        }
+
+        uint64_t value = 0;
+        if (readUnsigned(dir + "coherency_line_size", value)) {
+            cache.line_size = static_cast<size_t>(value);
+        }
+        if (readUnsigned(dir + "ways_of_associativity", value)) {
+            cache.associativity = static_cast<unsigned>(value);
+        }
+        if (readFirstLine(dir + "shared_cpu_list", text)) {
+            cache.shared_cpu_count = static_cast<unsigned>(parseCpuList(text).size());
+        }
+        caches.push_back(cache);
+    }
+    return caches;
+}
+
+#if defined(__APPLE__)
+
+/**
+ * @brief Detect the cache hierarchy through sysctl
+ * @return Caches reported by the kernel; sharing and associativity are unknown
+ */
+inline std::vector<CacheInfo> detectCachesApple() {
+    auto read = [](const char* name) -> size_t {
+        int64_t value = 0;
+        size_t size = sizeof(value);
+        return sysctlbyname(name, &value, &size, nullptr, 0) == 0 && value > 0
+                   ? static_cast<size_t>(value)
+                   : 0;
+    };
+
+    std::vector<CacheInfo> caches;
+    const size_t line_size = read("hw.cachelinesize");
+    auto add = [&](int level, CacheType type, const char* name) {
+        const size_t size = read(name);
+        if (size != 0) {
+            caches.push_back(CacheInfo{level, type, size, line_size, 0, 0});
+        }
+    };
+    add(1, CacheType::data, "hw.l1dcachesize");
+    add(1, CacheType::instruction, "hw.l1icachesize");
+    add(2, CacheType::unified, "hw.l2cachesize");
+    add(3, CacheType::unified, "hw.l3cachesize");
+    return caches;
+}
+
+#endif  // __APPLE__
+
+/**
+ * @brief Detect the cache hierarchy with the best source for this system
+ * @return Cache topology; empty if nothing could be detected
+ */
+inline CacheTopology detectCacheTopology() {
+    // sysfs lists the exact CPUs sharing each cache, so it is preferred where
+    // available; CPUID covers other systems and containers without /sys
+    CacheTopology topology;
+    topology.caches = detectCachesFromSysfs("/sys/devices/system/cpu/cpu0");
+#if TRLC_HAS_X86_INTRINSICS
+    if (topology.caches.empty()) {
+        topology.caches = detectCachesX86();
+    }
+#endif
+#if defined(__APPLE__)
+    if (topology.caches.empty()) {
+        topology.caches = detectCachesApple();
+    }
+#endif
+    sortCaches(topology.caches);
+    return topology;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Get the cache hierarchy of the running CPU
+ *
+ * Detected on the first call and cached; later calls return the same object.
+ *
+ * @return Cache topology; CacheTopology::isDetected() is false when no
+ *         source of cache information is available
+ *
+ * @example
+ * @code
+ * const auto& caches = trlc::platform::getCacheTopology();
+ * size_t block = caches.l2Size() != 0 ? caches.l2Size() / 2 : 256 * 1024;
+ * @endcode
+ */
+inline const CacheTopology& getCacheTopology() noexcept {
+    // Detection allocates; running out of memory leaves the hierarchy undetected
+    static const CacheTopology topology = [] {
+        try {
+            return detail::detectCacheTopology();
+        } catch (...) {
+            return CacheTopology{};
+        }
+    }();
+    return topology;
+}
+
+//
+// Processor topology
+//
+
+/**
+ * @brief Kind of core a logical CPU belongs to
+ *
+ * Hybrid processors (Intel P-cores/E-cores, Arm big.LITTLE) combine fast
+ * cores with smaller, power-efficient ones. On homogeneous processors every
+ * core is reported as a performance core; so is every core of a processor
+ * that publishes no capacity information at all.
+ */
+enum class CoreType : int {
+    unknown = 0,  ///< Core type could not be determined
+    performance,  ///< High-performance core (Intel Core, Arm "big")
+    efficiency    ///< Power-efficient core (Intel Atom, Arm "LITTLE")
+};
+
+/**
+ * @brief Get the display name of a core type
+ * @param type Core type
+ * @return "performance", "efficiency" or "unknown"
+ */
+constexpr const char* coreTypeName(CoreType type) noexcept {
+    switch (type) {
+        case CoreType::performance:
+            return "performance";
+        case CoreType::efficiency:
+            return "efficiency";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @brief Placement of one logical CPU
+ */
+struct LogicalCpu {
+    int cpu_id;                         ///< Operating system CPU number
+    int core_id;                        ///< Physical core ID, unique within the package
+    int package_id;                     ///< Physical package (socket) ID
+    int node_id;                        ///< NUMA node ID (0 when NUMA is not reported)
+    std::vector<int> thread_siblings;   ///< Logical CPUs on the same core, including this one
+    std::vector<int> package_siblings;  ///< Logical CPUs in the same package, including this one
+    CoreType core_type;                 ///< Performance or efficiency core
+    uint32_t capacity;                  ///< cpu_capacity, or max kHz except on x86 (0 if unknown)
+};
+
+/**
+ * @brief Mapping of logical CPUs to cores, packages and NUMA nodes
+ *
+ * Lists the CPUs that were online when the topology was detected, ordered
+ * by CPU number.
+ */
+struct CpuTopology {
+    std::vector<LogicalCpu> cpus;  ///< Online logical CPUs ordered by cpu_id
+    size_t core_count;             ///< Number of physical cores
+    size_t package_count;          ///< Number of physical packages (sockets)
+    size_t node_count;             ///< Number of NUMA nodes (1 when NUMA is not reported)
+    bool is_hybrid;                ///< true if performance and efficiency cores are mixed
+
+    /**
+     * @brief Find a logical CPU by its operating system number
+     * @param cpu_id CPU number
+     * @return Pointer to the CPU, or nullptr if it is not online
+     */
+    const LogicalCpu* find(int cpu_id) const noexcept {
+        for (const LogicalCpu& cpu : cpus) {
+            if (cpu.cpu_id == cpu_id) {
+                return &cpu;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @return Number of online logical CPUs
+    size_t logicalCpuCount() const noexcept { return cpus.size(); }
+
+    /// @return true if any core runs more than one hardware thread
+    bool hasSmt() const noexcept { return cpus.size() > core_count; }
+
+    /**
+     * @brief List the logical CPUs of a NUMA node
+     * @param node_id NUMA node ID
+     * @return CPU numbers in ascending order
+     */
+    std::vector<int> cpusInNode(int node_id) const {
+        std::vector<int> result;
+        for (const LogicalCpu& cpu : cpus) {
+            if (cpu.node_id == node_id) {
+                result.push_back(cpu.cpu_id);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief List the logical CPUs of a package
+     * @param package_id Package ID
+     * @return CPU numbers in ascending order
+     */
+    std::vector<int> cpusInPackage(int package_id) const {
+        std::vector<int> result;
+        for (const LogicalCpu& cpu : cpus) {
+            if (cpu.package_id == package_id) {
+                result.push_back(cpu.cpu_id);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief List the logical CPUs of one core type
+     *
+     * On hybrid processors this selects the cores to pin latency-critical
+     * threads (performance) or background work (efficiency) to.
+     *
+     * @param type Core type
+     * @return CPU numbers in ascending order
+     */
+    std::vector<int> cpusOfType(CoreType type) const {
+        std::vector<int> result;
+        for (const LogicalCpu& cpu : cpus) {
+            if (cpu.core_type == type) {
+                result.push_back(cpu.cpu_id);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief List one logical CPU per physical core
+     *
+     * Placing one thread on each listed CPU avoids sharing a core between
+     * two threads while idle cores remain.
+     *
+     * @return Lowest-numbered CPU of every core, in ascending order
+     */
+    std::vector<int> firstThreadPerCore() const {
+        std::vector<int> result;
+        for (const LogicalCpu& cpu : cpus) {
+            if (!cpu.thread_siblings.empty() && cpu.thread_siblings.front() == cpu.cpu_id) {
+                result.push_back(cpu.cpu_id);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Check whether the topology was detected
+     * @return true if at least one logical CPU is described
+     */
+    bool isDetected() const noexcept { return !cpus.empty(); }
+};
+
+namespace detail {
+
+/**
+ * @brief Fill the derived counts and sibling lists of a topology
+ *
+ * Sibling lists that are already present are kept; missing ones are
+ * derived from the core and package IDs.
+ *
+ * @param topology Topology whose cpus are populated
+ */
+inline void finalizeCpuTopology(CpuTopology& topology) {
+    std::sort(topology.cpus.begin(),
+              topology.cpus.end(),
+              [](const LogicalCpu& lhs, const LogicalCpu& rhs) { return lhs.cpu_id < rhs.cpu_id; });
+
+    std::vector<std::pair<int, int>> cores;
+    std::vector<int> packages;
+    std::vector<int> nodes;
+    for (LogicalCpu& cpu : topology.cpus) {
+        const bool need_threads = cpu.thread_siblings.empty();
+        const bool need_package = cpu.package_siblings.empty();
+        for (const LogicalCpu& other : topology.cpus) {
+            const bool same_package = other.package_id == cpu.package_id;
+            if (need_threads && same_package && other.core_id == cpu.core_id) {
+                cpu.thread_siblings.push_back(other.cpu_id);
+            }
+            if (need_package && same_package) {
+                cpu.package_siblings.push_back(other.cpu_id);
+            }
+        }
+        cores.emplace_back(cpu.package_id, cpu.core_id);
+        packages.push_back(cpu.package_id);
+        nodes.push_back(cpu.node_id);
+    }
+
+    auto count_unique = [](auto& values) {
+        std::sort(values.begin(), values.end());
+        return static_cast<size_t>(std::unique(values.begin(), values.end()) - values.begin());
+    };
+    topology.core_count = count_unique(cores);
+    topology.package_count = count_unique(packages);
+    topology.node_count = std::max<size_t>(count_unique(nodes), 1);
+}
+
+/**
+ * @brief Read the processor topology from sysfs
+ * @param cpu_root CPU directory, normally "/sys/devices/system/cpu"
+ * @param node_root NUMA node directory, normally "/sys/devices/system/node"
+ * @return Topology; empty if the CPU directory is unavailable
+ */
+inline CpuTopology detectCpuTopologyFromSysfs(const std::string& cpu_root,
+                                              const std::string& node_root) {
+    CpuTopology topology{};
+
+    std::string text;
+    if (!readFirstLine(cpu_root + "/online", text)) {
+        return topology;
+    }
+
+    for (int cpu_id : parseCpuList(text)) {
+        const std::string dir = cpu_root + "/cpu" + std::to_string(cpu_id) + "/topology/";
+
+        // physical_package_id is -1 where firmware does not describe sockets
+        LogicalCpu cpu{cpu_id, cpu_id, 0, 0, {}, {}, CoreType::unknown, 0};
+        uint64_t value = 0;
+        if (readUnsigned(dir + "core_id", value)) {
+            cpu.core_id = static_cast<int>(value);
+        }
+        if (readUnsigned(dir + "physical_package_id", value)) {
+            cpu.package_id = static_cast<int>(value);
+        }
+        if (readFirstLine(dir + "thread_siblings_list", text)) {
+            cpu.thread_siblings = parseCpuList(text);
+        }
+        if (readFirstLine(dir + "core_siblings_list", text)) {
+            cpu.package_siblings = parseCpuList(text);
+        }
+
+        // cpu_capacity is published on heterogeneous Arm systems; otherwise
+        // the maximum frequency is the best available hint. On x86 favored
+        // cores (Turbo Boost Max 3.0) report a higher maximum than the other
+        // P-cores, so frequency says nothing about the core type there.
+        const std::string cpu_dir = cpu_root + "/cpu" + std::to_string(cpu_id) + "/";
+        bool has_capacity = readUnsigned(cpu_dir + "cpu_capacity", value);
+#if !TRLC_HAS_X86_INTRINSICS
+        has_capacity = has_capacity || readUnsigned(cpu_dir + "cpufreq/cpuinfo_max_freq", value);
+#endif
+        if (has_capacity) {
+            cpu.capacity = static_cast<uint32_t>(value);
+        }
+        topology.cpus.push_back(cpu);
+    }
+
+    if (readFirstLine(node_root + "/online", text)) {
+        for (int node_id : parseCpuList(text)) {
+            const std::string node_dir = node_root + "/node" + std::to_string(node_id);
+            std::string cpulist;
+            if (!readFirstLine(node_dir + "/cpulist", cpulist)) {
+                continue;
+            }
+            for (int cpu_id : parseCpuList(cpulist)) {
+                for (LogicalCpu& cpu : topology.cpus) {
+                    if (cpu.cpu_id == cpu_id) {
+                        cpu.node_id = node_id;
+                    }
+                }
+            }
+        }
+    }
+
+    finalizeCpuTopology(topology);
+    return topology;
+}
+
+/**
+ * @brief Build a topology from thread and core counts
+ *
+ * Assumes the operating system numbers hardware threads of a core
+ * consecutively and fills one package before the next, which is how
+ * Windows and macOS enumerate CPUs. Each package is treated as one node.
+ *
+ * @param logical_count Number of logical CPUs
+ * @param threads_per_core Hardware threads per core
+ * @param logical_per_package Logical CPUs per package
+ * @return Synthetic topology
+ */
+inline CpuTopology makeUniformCpuTopology(size_t logical_count,
+                                          size_t threads_per_core,
+                                          size_t logical_per_package) {
+    CpuTopology topology{};
+    threads_per_core = std::max<size_t>(threads_per_core, 1);
+    logical_per_package = std::max(logical_per_package, threads_per_core);
+    for (size_t index = 0; index < logical_count; ++index) {
+        const int package = static_cast<int>(index / logical_per_package);
+        const int core = static_cast<int>((index % logical_per_package) / threads_per_core);
+        topology.cpus.push_back(LogicalCpu{static_cast<int>(index),
+                                           core,
+                                           package,
+                                           package,
+                                           {},
+                                           {},
+                                           CoreType::unknown,
+                                           0});
+    }
+    finalizeCpuTopology(topology);
+    return topology;
+}
+
+#if TRLC_HAS_X86_INTRINSICS
+
+/**
+ * @brief Derive the topology from the CPUID extended topology leaf
+ *
+ * Leaf 0x1F (or 0xB on older CPUs) reports how many logical processors
+ * share each topology level. It describes only the calling CPU, so the
+ * per-CPU mapping is derived with makeUniformCpuTopology().
+ *
+ * @return Topology; empty if the CPU has no extended topology leaf
+ */
+inline CpuTopology detectCpuTopologyX86() {
+    uint32_t regs[4];
+    cpuid(0, 0, regs);
+    const uint32_t max_leaf = regs[0];
+
+    uint32_t leaf = 0;
+    if (max_leaf >= 0x1F) {
+        cpuid(0x1F, 0, regs);
+        leaf = regs[1] != 0 ? 0x1F : 0;
+    }
+    if (leaf == 0 && max_leaf >= 0xB) {
+        cpuid(0xB, 0, regs);
+        leaf = regs[1] != 0 ? 0xB : 0;
+    }
+    if (leaf == 0) {
+        return {};
+    }
+
+    size_t threads_per_core = 1;
+    size_t logical_per_package = 1;
+    for (uint32_t subleaf = 0; subleaf < 8; ++subleaf) {
+        cpuid(leaf, subleaf, regs);
+        const uint32_t level_type = (regs[2] >> 8) & 0xFF;  // ECX[15:8]
+        if (level_type == 0) {
+            break;
+        }
+        const size_t count = regs[1] & 0xFFFF;  // EBX[15:0]
+        if (level_type == 1) {
+            threads_per_core = count;  // SMT level
+        }
+        logical_per_package = count;  // The last level spans the package
+    }
+
+    size_t logical_count = std::thread::hardware_concurrency();
+    if (logical_count == 0) {
+        logical_count = logical_per_package;
+    }
+    return makeUniformCpuTopology(logical_count, threads_per_core, logical_per_package);
+}
+
+#endif  // TRLC_HAS_X86_INTRINSICS
+
+/**
+ * @brief Classify cores by their relative capacity
+ *
+ * Cores with the highest capacity are performance cores and all others are
+ * efficiency cores, so the middle cores of a three-tier Arm design count as
+ * efficiency cores.
+ *
+ * @param topology Topology whose capacities are populated
+ * @return false (and no change) if any capacity is unknown
+ */
+inline bool classifyCoreTypesByCapacity(CpuTopology& topology) noexcept {
+    uint32_t max_capacity = 0;
+    for (const LogicalCpu& cpu : topology.cpus) {
+        if (cpu.capacity == 0) {
+            return false;
+        }
+        max_capacity = std::max(max_capacity, cpu.capacity);
+    }
+    for (LogicalCpu& cpu : topology.cpus) {
+        cpu.core_type =
+            cpu.capacity == max_capacity ? CoreType::performance : CoreType::efficiency;
+    }
+    return !topology.cpus.empty();
+}
+
+/**
+ * @brief Check whether any CPU has a known capacity
+ * @param topology Topology to inspect
+ * @return true if at least one capacity is non-zero
+ */
+inline bool hasCapacityData(const CpuTopology& topology) noexcept {
+    for (const LogicalCpu& cpu : topology.cpus) {
+        if (cpu.capacity != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Read hybrid core lists from the perf PMU devices
+ *
+ * Linux registers separate PMUs for the two core types of hybrid Intel
+ * processors, each listing the CPUs it covers.
+ *
+ * @param topology Topology to update
+ * @param devices_root Device directory, normally "/sys/devices"
+ * @return true if either core list was found
+ */
+inline bool readCoreTypesFromPmu(CpuTopology& topology, const std::string& devices_root) {
+    bool found = false;
+    const struct {
+        const char* pmu;
+        CoreType type;
+    } lists[] = {{"/cpu_core/cpus", CoreType::performance},
+                 {"/cpu_atom/cpus", CoreType::efficiency}};
+
+    for (const auto& list : lists) {
+        std::string text;
+        if (!readFirstLine(devices_root + list.pmu, text)) {
+            continue;
+        }
+        found = true;
+        for (int cpu_id : parseCpuList(text)) {
+            for (LogicalCpu& cpu : topology.cpus) {
+                if (cpu.cpu_id == cpu_id) {
+                    cpu.core_type = list.type;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+#if TRLC_HAS_X86_INTRINSICS
+
+/**
+ * @brief Get the core type of the calling CPU from CPUID leaf 0x1A
+ * @return Core type, or unknown if the leaf reports none
+ */
+inline CoreType currentCoreTypeX86() noexcept {
+    uint32_t regs[4];
+    cpuid(0x1A, 0, regs);
+    switch (regs[0] >> 24) {  // EAX[31:24]
+        case 0x40:
+            return CoreType::performance;  // Intel Core
+        case 0x20:
+            return CoreType::efficiency;  // Intel Atom
+        default:
+            return CoreType::unknown;
+    }
+}
+
+/**
+ * @brief Get the core type of one CPU by running CPUID leaf 0x1A on it
+ *
+ * Must be called on a thread whose affinity may be changed freely; the
+ * thread stays on @p cpu_id afterwards.
+ *
+ * @param cpu_id Logical CPU ID
+ * @return Core type, or unknown if the thread cannot run there
+ */
+inline CoreType probeCoreTypeX86(int cpu_id) noexcept {
+#if defined(__linux__)
+    if (cpu_id < 0 || cpu_id >= CPU_SETSIZE) {
+        return CoreType::unknown;
+    }
+    cpu_set_t target;
+    CPU_ZERO(&target);
+    CPU_SET(cpu_id, &target);
+    if (sched_setaffinity(0, sizeof(target), &target) != 0 || sched_getcpu() != cpu_id) {
+        return CoreType::unknown;
+    }
+    return currentCoreTypeX86();
+#else
+    static_cast<void>(cpu_id);
+    return CoreType::unknown;
+#endif
+}
+
+/**
+ * @brief Detect x86 core types
+ *
+ * Non-hybrid processors get performance for every CPU. On hybrid
+ * processors the perf PMU lists are used when present. Otherwise only the
+ * CPU the caller runs on is classified with CPUID leaf 0x1A; the calling
+ * thread is never moved, so the other CPUs stay unknown. probeCoreTypes()
+ * classifies them all on request. Capacities are not used because on x86
+ * they follow turbo ratios, which also differ between favored P-cores.
+ *
+ * @param topology Topology to update
+ */
+inline void detectCoreTypesX86(CpuTopology& topology) {
+    uint32_t regs[4];
+    cpuid(0, 0, regs);
+    bool hybrid = false;
+    if (regs[0] >= 0x1A) {
+        cpuid(7, 0, regs);
+        hybrid = (regs[3] & (1u << 15)) != 0;  // CPUID.7.0:EDX[15]
+    }
+
+    if (!hybrid) {
+        for (LogicalCpu& cpu : topology.cpus) {
+            cpu.core_type = CoreType::performance;
+        }
+        return;
+    }
+    if (readCoreTypesFromPmu(topology, "/sys/devices")) {
+        return;
+    }
+
+#if defined(__linux__)
+    // Accept the answer only if no migration happened around CPUID
+    const int before = sched_getcpu();
+    const CoreType type = currentCoreTypeX86();
+    if (before >= 0 && sched_getcpu() == before) {
+        for (LogicalCpu& cpu : topology.cpus) {
+            if (cpu.cpu_id == before) {
+                cpu.core_type = type;
+            }
+        }
+    }
+#endif
+}
+
+#endif  // TRLC_HAS_X86_INTRINSICS
+
+/**
+ * @brief Set is_hybrid from the core types assigned so far
+ * @param topology Topology to update
+ */
+inline void updateHybridFlag(CpuTopology& topology) noexcept {
+    bool has_performance = false;
+    bool has_efficiency = false;
+    for (const LogicalCpu& cpu : topology.cpus) {
+        has_performance = has_performance || cpu.core_type == CoreType::performance;
+        has_efficiency = has_efficiency || cpu.core_type == CoreType::efficiency;
+    }
+    topology.is_hybrid = has_performance && has_efficiency;
+}
+
+/**
+ * @brief Assign a core type to every CPU of a topology
+ * @param topology Topology to update
+ */
+inline void detectCoreTypes(CpuTopology& topology) {
+#if TRLC_HAS_X86_INTRINSICS
+    detectCoreTypesX86(topology);
+#else
+    if (!classifyCoreTypesByCapacity(topology) && !hasCapacityData(topology)) {
+        // Homogeneous servers and VMs publish neither cpu_capacity nor cpufreq
+        for (LogicalCpu& cpu : topology.cpus) {
+            cpu.core_type = CoreType::performance;
+        }
+    }
+#endif
+    updateHybridFlag(topology);
+}
+
+/**
+ * @brief Detect the processor topology with the best source for this system
+ * @return Topology; a flat one-core-per-CPU layout if nothing else is available
+ */
+inline CpuTopology detectCpuTopology() {
+    CpuTopology topology =
+        detectCpuTopologyFromSysfs("/sys/devices/system/cpu", "/sys/devices/system/node");
+#if TRLC_HAS_X86_INTRINSICS
+    if (!topology.isDetected()) {
+        topology = detectCpuTopologyX86();
+    }
+#endif
+    if (!topology.isDetected()) {
+        const size_t logical_count = std::max(std::thread::hardware_concurrency(), 1u);
+        topology = makeUniformCpuTopology(logical_count, 1, logical_count);
+    }
+    detectCoreTypes(topology);
+    return topology;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Get the processor topology of the running system
+ *
+ * Detected on the first call and cached; later calls return the same object.
+ * CPUs brought online later are not included.
+ *
+ * @return Processor topology; CpuTopology::isDetected() is false if detection
+ *         could not allocate
+ *
+ * @example
+ * @code
+ * const auto& topology = trlc::platform::getCpuTopology();
+ * for (int cpu : topology.firstThreadPerCore()) {
+ *     // Start one worker per physical core
+ * }
+ * @endcode
+ */
+inline const CpuTopology& getCpuTopology() noexcept {
+    // Detection allocates; running out of memory leaves the topology undetected
+    static const CpuTopology topology = [] {
+        try {
+            return detail::detectCpuTopology();
+        } catch (...) {
+            return CpuTopology{};
+        }
+    }();
+    return topology;
+}
+
+/**
+ * @brief Classify every CPU of a hybrid processor by running on it
+ *
+ * getCpuTopology() never moves the calling thread, so on hybrid x86
+ * systems without the PMU core lists it only knows the type of
+ * the CPU it was first called on. This function starts a helper thread,
+ * moves it to each CPU in turn to execute CPUID leaf 0x1A and returns a
+ * copy of the topology with the results. The caller's affinity is never
+ * changed. CPUs the helper cannot run on stay unknown. Elsewhere the
+ * cached topology is returned unchanged.
+ *
+ * @return Topology with core types probed on each CPU
+ */
+inline CpuTopology probeCoreTypes() {
+    CpuTopology topology = getCpuTopology();
+#if TRLC_HAS_X86_INTRINSICS && defined(__linux__)
+    if (topology.cpusOfType(CoreType::unknown).empty()) {
+        return topology;
+    }
+    std::thread helper([&topology] {
+        for (LogicalCpu& cpu : topology.cpus) {
+            if (cpu.core_type == CoreType::unknown) {
+                cpu.core_type = detail::probeCoreTypeX86(cpu.cpu_id);
+            }
+        }
+    });
+    helper.join();
+    detail::updateHybridFlag(topology);
+#endif
+    return topology;
+}
+
+}  // namespace platform
+}  // namespace trlc
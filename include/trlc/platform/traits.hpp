@@ -101,7 +101,7 @@ constexpr bool hasFeature<LanguageFeature::memory_sanitizer>() noexcept {
  */
 template <RuntimeFeature TFeature>
 bool hasRuntimeFeature() noexcept {
-    return getFeatureSet().hasRuntimeFeature(TFeature);
+    return hasRuntimeFeature(TFeature);
 }
 
 // Specializations for common runtime features (for better optimization)
@@ -150,6 +150,176 @@ inline bool hasRuntimeFeature<RuntimeFeature::neon>() noexcept {
     return hasNeonSupport();
 }
 
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::hardware_aes>() noexcept {
+    return hasHardwareAes();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::hardware_random>() noexcept {
+    return hasHardwareRandom();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::popcnt>() noexcept {
+    return hasPopcntSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::lzcnt>() noexcept {
+    return hasLzcntSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::bmi1>() noexcept {
+    return hasBmi1Support();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::bmi2>() noexcept {
+    return hasBmi2Support();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::fma>() noexcept {
+    return hasFmaSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::f16c>() noexcept {
+    return hasF16cSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::pclmulqdq>() noexcept {
+    return hasPclmulqdqSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::sha>() noexcept {
+    return hasShaSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::vaes>() noexcept {
+    return hasVaesSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::vpclmulqdq>() noexcept {
+    return hasVpclmulqdqSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::avx512bw>() noexcept {
+    return hasAvx512bwSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::avx512dq>() noexcept {
+    return hasAvx512dqSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::avx512vl>() noexcept {
+    return hasAvx512vlSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::avx512vnni>() noexcept {
+    return hasAvx512vnniSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::avx512vbmi>() noexcept {
+    return hasAvx512vbmiSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::avx_vnni>() noexcept {
+    return hasAvxVnniSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::rdseed>() noexcept {
+    return hasRdseedSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::movbe>() noexcept {
+    return hasMovbeSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::erms>() noexcept {
+    return hasErmsSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::fsrm>() noexcept {
+    return hasFsrmSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::amx_tile>() noexcept {
+    return hasAmxTileSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::amx_int8>() noexcept {
+    return hasAmxInt8Support();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::amx_bf16>() noexcept {
+    return hasAmxBf16Support();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::sve>() noexcept {
+    return hasSveSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::sve2>() noexcept {
+    return hasSve2Support();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::crc32>() noexcept {
+    return hasCrc32Support();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::dotprod>() noexcept {
+    return hasDotprodSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::lse_atomics>() noexcept {
+    return hasLseAtomicsSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::ssse3>() noexcept {
+    return hasSsse3Support();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::cx16>() noexcept {
+    return hasCx16Support();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::lahf_sahf>() noexcept {
+    return hasLahfSahfSupport();
+}
+
+template <>
+inline bool hasRuntimeFeature<RuntimeFeature::avx512cd>() noexcept {
+    return hasAvx512cdSupport();
+}
+
 namespace traits {
 
 // =============================================================================
@@ -0,0 +1,122 @@
+/**
+ * @file test_affinity.cpp
+ * @brief Tests for topology-driven thread pinning
+ *
+ * Tests thread affinity queries and pinning on the running system and the
+ * core-first placement order on synthetic topologies.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+#include "trlc/platform/affinity.hpp"
+
+namespace trlc::platform::test {
+
+void testSpreadOrder() {
+    std::cout << "Testing core-first placement order..." << std::endl;
+
+    // Two packages of two cores with two threads each, siblings numbered
+    // far apart as Linux does on x86: core N has CPUs N and N + 4
+    CpuTopology topology = detail::makeUniformCpuTopology(8, 1, 4);
+    for (LogicalCpu& cpu : topology.cpus) {
+        const int first = cpu.cpu_id % 4;
+        cpu.core_id = first % 2;
+        cpu.package_id = first / 2;
+        cpu.thread_siblings = {first, first + 4};
+        cpu.package_siblings.clear();
+    }
+
+    // One thread per core first, alternating packages, then the siblings
+    assert((spreadCpuOrder(topology) == std::vector<int>{0, 2, 1, 3, 4, 6, 5, 7}));
+
+    // Disallowed CPUs are skipped and their siblings move up a round
+    assert((spreadCpuOrder(topology, {1, 2, 4, 5}) == std::vector<int>{4, 2, 1, 5}));
+
+    // Without SMT the order is the package-interleaved CPU list
+    CpuTopology flat = detail::makeUniformCpuTopology(4, 1, 2);
+    assert((spreadCpuOrder(flat) == std::vector<int>{0, 2, 1, 3}));
+
+    std::cout << "  ✓ Physical cores are used before SMT siblings" << std::endl;
+}
+
+void testThreadPinning() {
+    std::cout << "Testing thread pinning..." << std::endl;
+
+    const std::vector<int> original = getCurrentThreadAffinity();
+    std::cout << "  - Current affinity: " << original.size() << " CPUs" << std::endl;
+
+#if defined(__linux__)
+    assert(!original.empty());
+
+    const int cpu = original.front();
+    assert(pinToCpu(cpu));
+    assert((getCurrentThreadAffinity() == std::vector<int>{cpu}));
+
+    const LogicalCpu* logical = getCpuTopology().find(cpu);
+    assert(logical != nullptr);
+    assert(pinToCore(cpu));
+    for (int allowed : getCurrentThreadAffinity()) {
+        const std::vector<int>& siblings = logical->thread_siblings;
+        assert(std::find(siblings.begin(), siblings.end(), allowed) != siblings.end());
+    }
+
+    assert(pinToNode(logical->node_id));
+
+    // Invalid requests fail and leave the affinity alone
+    assert(pinCurrentThread(original));
+    assert(!pinCurrentThread({}));
+    assert(!pinCurrentThread({-1}));
+    assert(!pinToCore(-1));
+    assert(getCurrentThreadAffinity() == original);
+#else
+    assert(!pinToCpu(0));
+#endif
+
+    std::cout << "  ✓ Thread pinning works correctly" << std::endl;
+}
+
+void testSpreadPlacement() {
+    std::cout << "Testing pool placement..." << std::endl;
+
+    const std::vector<int> placement = spreadPlacement(5);
+    assert(placement.size() == 5);
+    for (int cpu : placement) {
+        assert(getCpuTopology().find(cpu) != nullptr);
+    }
+    std::cout << "  - 5 threads placed on CPUs";
+    for (int cpu : placement) {
+        std::cout << " " << cpu;
+    }
+    std::cout << std::endl;
+
+    assert(spreadPlacement(0).empty());
+
+    std::cout << "  ✓ Pool placement uses known CPUs" << std::endl;
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Affinity Tests ===" << std::endl;
+
+    try {
+        testSpreadOrder();
+        testThreadPinning();
+        testSpreadPlacement();
+
+        std::cout << "\n✅ All affinity tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
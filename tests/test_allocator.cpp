@@ -0,0 +1,130 @@
+/**
+ * @file test_allocator.cpp
+ * @brief Tests for over-aligned allocation
+ *
+ * Tests AlignedAllocator with standard containers and the owning pointers
+ * created by makeAlignedUnique().
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <stdexcept>
+#include <vector>
+
+#include "trlc/platform/allocator.hpp"
+
+namespace trlc::platform::test {
+
+bool isAligned(const void* pointer, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+/// Counts live instances to check construction and destruction
+struct Tracked {
+    static inline int live = 0;
+    static inline int throw_after = -1;
+
+    int value;
+
+    Tracked() : value(7) {
+        if (throw_after == 0) {
+            throw std::runtime_error("construction failed");
+        }
+        --throw_after;
+        ++live;
+    }
+    explicit Tracked(int initial) : value(initial) { ++live; }
+    ~Tracked() { --live; }
+};
+
+void testAlignedAllocator() {
+    std::cout << "Testing AlignedAllocator..." << std::endl;
+
+    static_assert(AlignedAllocator<char>::alignment == getCacheLineSize());
+    static_assert(AlignedAllocator<double, 256>::alignment == 256);
+
+    std::vector<float, AlignedAllocator<float>> samples;
+    for (int i = 0; i < 1000; ++i) {
+        samples.push_back(static_cast<float>(i));
+        assert(isAligned(samples.data(), getCacheLineSize()));
+    }
+    assert(samples[999] == 999.0f);
+
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 4096>> page(100);
+    assert(isAligned(page.data(), 4096));
+
+    // Node-based containers rebind the allocator to their node type
+    std::list<int, AlignedAllocator<int, 64>> values{1, 2, 3};
+    values.push_back(4);
+    assert(values.size() == 4 && values.back() == 4);
+
+    assert((AlignedAllocator<int, 64>() == AlignedAllocator<float, 64>()));
+    assert((AlignedAllocator<int, 64>() != AlignedAllocator<int, 128>()));
+
+    std::cout << "  ✓ AlignedAllocator returns aligned storage" << std::endl;
+}
+
+void testMakeAlignedUnique() {
+    std::cout << "Testing makeAlignedUnique..." << std::endl;
+
+    auto buffer = makeAlignedUnique<float[]>(4096);
+    assert(isAligned(buffer.get(), getCacheLineSize()));
+    assert(buffer[0] == 0.0f && buffer[4095] == 0.0f);  // Value-initialized
+
+    auto wide = makeAlignedUnique<double[], 512>(3);
+    assert(isAligned(wide.get(), 512));
+
+    {
+        auto objects = makeAlignedUnique<Tracked[]>(5);
+        assert(Tracked::live == 5);
+        assert(objects[4].value == 7);
+
+        auto single = makeAlignedUnique<Tracked, 128>(42);
+        assert(isAligned(single.get(), 128));
+        assert(single->value == 42);
+        assert(Tracked::live == 6);
+    }
+    assert(Tracked::live == 0);
+
+    // A throwing constructor destroys the elements built so far
+    Tracked::throw_after = 3;
+    bool thrown = false;
+    try {
+        auto failing = makeAlignedUnique<Tracked[]>(10);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(Tracked::live == 0);
+    Tracked::throw_after = -1;
+
+    auto empty = makeAlignedUnique<int[]>(0);
+    assert(empty != nullptr);
+
+    std::cout << "  ✓ makeAlignedUnique creates and destroys aligned objects" << std::endl;
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Allocator Tests ===" << std::endl;
+
+    try {
+        testAlignedAllocator();
+        testMakeAlignedUnique();
+
+        std::cout << "\n✅ All allocator tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ * @file test_arena.cpp
+ * @brief Tests for the monotonic arena allocator
+ *
+ * Tests bump allocation, chunk growth and reuse across reset(), the
+ * embedded first block of InlineArena and the std::pmr adapter.
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "trlc/platform/arena.hpp"
+
+namespace trlc::platform::test {
+
+void testBumpAllocation() {
+    std::cout << "Testing bump allocation..." << std::endl;
+
+    Arena arena;
+    assert(arena.chunkCount() == 0);
+    assert(arena.capacity() == 0);
+
+    auto* first = static_cast<unsigned char*>(arena.allocate(10, 1));
+    auto* second = static_cast<unsigned char*>(arena.allocate(10, 1));
+    assert(first != nullptr);
+    assert(second == first + 10);  // Consecutive in the same chunk
+    assert(arena.chunkCount() == 1);
+    assert(arena.capacity() + sizeof(detail::ArenaChunk) == getRuntimePageSize());
+    assert(arena.bytesAllocated() == 20);
+
+    for (size_t alignment = 1; alignment <= 4096; alignment *= 2) {
+        void* memory = arena.allocate(3, alignment);
+        assert(isAligned(memory, alignment));
+        std::memset(memory, 0xab, 3);
+    }
+    void* line = arena.allocateCacheAligned(1);
+    assert(isAligned(line, getCacheLineSize()));
+    assert(isAligned(arena.allocate(1, alignof(std::max_align_t)), alignof(std::max_align_t)));
+
+    std::cout << "  ✓ Allocations are contiguous and aligned" << std::endl;
+}
+
+void testChunkGrowthAndReset() {
+    std::cout << "Testing chunk growth and reset..." << std::endl;
+
+    const size_t page_size = getRuntimePageSize();
+    Arena arena;
+    std::vector<void*> blocks;
+    for (int i = 0; i < 1000; ++i) {
+        blocks.push_back(arena.allocate(100));
+    }
+    const size_t chunks = arena.chunkCount();
+    const size_t capacity = arena.capacity();
+    assert(chunks > 1);
+    assert(chunks < 10);  // Chunk sizes grow geometrically
+    assert(capacity >= 1000 * 100);
+    std::cout << "  - 1000 x 100 bytes used " << chunks << " chunks, " << capacity
+              << " bytes" << std::endl;
+
+    // A request larger than the growth size gets a chunk of its own
+    void* large = arena.allocate(10 * page_size);
+    assert(large != nullptr);
+    assert(arena.chunkCount() == chunks + 1);
+
+    // reset() reuses the same chunks in the same order
+    arena.reset();
+    assert(arena.bytesAllocated() == 0);
+    assert(arena.chunkCount() == chunks + 1);
+    for (int i = 0; i < 1000; ++i) {
+        assert(arena.allocate(100) == blocks[static_cast<size_t>(i)]);
+    }
+    assert(arena.chunkCount() == chunks + 1);
+
+    arena.release();
+    assert(arena.chunkCount() == 0);
+    assert(arena.capacity() == 0);
+    assert(arena.allocate(1) != nullptr);
+
+    bool threw = false;
+    try {
+        arena.allocate(std::numeric_limits<size_t>::max() - 8);
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ Chunks grow by pages and survive reset()" << std::endl;
+}
+
+void testInlineArena() {
+    std::cout << "Testing inline first block..." << std::endl;
+
+    InlineArena<256> arena;
+    const auto* begin = reinterpret_cast<const unsigned char*>(&arena);
+    const auto* end = begin + sizeof(arena);
+
+    auto* small = static_cast<unsigned char*>(arena.allocate(64));
+    assert(small >= begin && small + 64 <= end);  // Served from the object itself
+    assert(arena.chunkCount() == 0);
+    assert(arena.capacity() == 256);
+
+    void* spill = arena.allocate(512);
+    const auto* spill_bytes = static_cast<const unsigned char*>(spill);
+    assert(spill_bytes < begin || spill_bytes >= end);
+    assert(arena.chunkCount() == 1);
+
+    // After reset() the inline block is used first again
+    arena.reset();
+    assert(arena.allocate(64) == small);
+    assert(arena.allocate(512) == spill);
+
+    std::cout << "  ✓ Inline block is used before heap chunks" << std::endl;
+}
+
+void testMemoryResource() {
+    std::cout << "Testing std::pmr adapter..." << std::endl;
+
+#if defined(__cpp_lib_memory_resource)
+    InlineArena<1024> arena;
+    ArenaResource resource(arena);
+    assert(&resource.arena() == &arena);
+
+    std::pmr::vector<std::pmr::string> names(&resource);
+    for (int i = 0; i < 100; ++i) {
+        names.emplace_back("a string long enough to need its own allocation " +
+                           std::to_string(i));
+    }
+    assert(names.size() == 100);
+    assert(names[42].get_allocator().resource() == &resource);
+    assert(names[99].back() == '9');
+    assert(arena.bytesAllocated() > 100 * 48);
+
+    // Equality is identity, as for std::pmr::monotonic_buffer_resource
+    ArenaResource same_arena(arena);
+    assert(resource.is_equal(resource));
+    assert(!resource.is_equal(same_arena));
+    std::cout << "  ✓ pmr containers allocate from the arena" << std::endl;
+#else
+    std::cout << "  - std::pmr not available" << std::endl;
+#endif
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Arena Tests ===" << std::endl;
+
+    try {
+        testBumpAllocation();
+        testChunkGrowthAndReset();
+        testInlineArena();
+        testMemoryResource();
+
+        std::cout << "\n✅ All arena tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
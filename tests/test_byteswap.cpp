@@ -0,0 +1,268 @@
+/**
+ * @file test_byteswap.cpp
+ * @brief Tests for vectorized bulk byte swapping
+ *
+ * Runs every kernel the CPU supports against the scalar byteSwap() for all
+ * element widths, with lengths around the vector block sizes and unaligned
+ * buffers, both in place and copying. Floating point, enumeration and
+ * 128-bit elements go through the same kernels as integers of their size.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "trlc/platform/byteswap.hpp"
+
+namespace trlc::platform::test {
+
+/// Feature bitmaps that select each kernel tier, capped to the running CPU
+std::vector<uint64_t> kernelTiers() {
+    const uint64_t cpu = detail::cpuFeatureBits();
+    return {0,
+            cpu & runtimeFeatureMask({RuntimeFeature::ssse3}),
+            cpu & runtimeFeatureMask({RuntimeFeature::ssse3, RuntimeFeature::avx2}),
+            cpu & runtimeFeatureMask({RuntimeFeature::neon}),
+            cpu};
+}
+
+template <size_t Size>
+void checkKernel(const Dispatch<detail::ByteSwapKernel>& kernel) {
+    using Word = detail::ByteSwapWord<Size>;
+
+    for (size_t count = 0; count <= 300; ++count) {
+        for (size_t misalign = 0; misalign < Size; ++misalign) {
+            std::vector<unsigned char> source(count * Size + misalign + 1);
+            for (size_t i = 0; i < source.size(); ++i) {
+                source[i] = static_cast<unsigned char>(i * 7 + count);
+            }
+            std::vector<unsigned char> destination(source.size(), 0xee);
+            unsigned char* in = source.data() + misalign;
+            unsigned char* out = destination.data() + misalign;
+
+            kernel(in, out, count);
+            for (size_t i = 0; i < count; ++i) {
+                Word original;
+                Word swapped;
+                std::memcpy(&original, in + i * Size, Size);
+                std::memcpy(&swapped, out + i * Size, Size);
+                assert(swapped == byteSwap(original));
+            }
+            // Nothing past the last element is written
+            assert(destination[misalign + count * Size] == 0xee);
+
+            // In place gives the same result as the copy
+            kernel(in, in, count);
+            assert(std::memcmp(in, out, count * Size) == 0);
+        }
+    }
+}
+
+void testKernels() {
+    std::cout << "Testing byte swap kernels..." << std::endl;
+
+    std::set<std::string> tested;
+    for (uint64_t features : kernelTiers()) {
+        const auto kernel16 = detail::selectByteSwapKernel<2>(features);
+        if (!tested.insert(kernel16.name()).second) {
+            continue;
+        }
+        checkKernel<2>(kernel16);
+        checkKernel<4>(detail::selectByteSwapKernel<4>(features));
+        checkKernel<8>(detail::selectByteSwapKernel<8>(features));
+#if TRLC_HAS_INT128
+        checkKernel<16>(detail::selectByteSwapKernel<16>(features));
+#endif
+        std::cout << "  - " << kernel16.name() << " kernel matches byteSwap()" << std::endl;
+    }
+    assert(tested.count("scalar") == 1);
+    assert(tested.count(byteSwapImplementation()) == 1);
+
+    std::cout << "  ✓ All supported kernels agree with scalar byteSwap()" << std::endl;
+}
+
+void testPublicInterface() {
+    std::cout << "Testing bulk byte swap functions..." << std::endl;
+    std::cout << "  - Selected implementation: " << byteSwapImplementation() << std::endl;
+
+    std::vector<uint16_t> shorts{0x0102, 0x0304, 0xa0b0};
+    byteSwapInPlace(shorts.data(), shorts.size());
+    assert((shorts == std::vector<uint16_t>{0x0201, 0x0403, 0xb0a0}));
+
+    std::vector<int32_t> ints(1000);
+    for (size_t i = 0; i < ints.size(); ++i) {
+        ints[i] = static_cast<int32_t>(i) - 500;
+    }
+    std::vector<int32_t> swapped(ints.size());
+    byteSwapCopy(ints.data(), swapped.data(), ints.size());
+    for (size_t i = 0; i < ints.size(); ++i) {
+        assert(swapped[i] == byteSwap(ints[i]));
+    }
+
+    std::vector<uint64_t> longs{0x0102030405060708ull};
+    byteSwapInPlace(longs.data(), longs.size());
+    assert(longs[0] == 0x0807060504030201ull);
+
+    // Single bytes have no order; copies are plain copies
+    uint8_t bytes[3] = {1, 2, 3};
+    uint8_t copied[3] = {};
+    byteSwapInPlace(bytes, 3);
+    byteSwapCopy(bytes, copied, 3);
+    assert(copied[0] == 1 && copied[2] == 3);
+
+    byteSwapInPlace(longs.data(), 0);
+    assert(longs[0] == 0x0807060504030201ull);
+
+#if defined(__cpp_lib_span)
+    byteSwapInPlace(std::span<uint16_t>(shorts));
+    assert((shorts == std::vector<uint16_t>{0x0102, 0x0304, 0xa0b0}));
+
+    std::vector<int32_t> back(ints.size() + 10, 0);
+    byteSwapCopy(std::span<const int32_t>(swapped), std::span<int32_t>(back));
+    assert(std::equal(ints.begin(), ints.end(), back.begin()));
+    assert(back[ints.size()] == 0);
+#endif
+
+    std::cout << "  ✓ Bulk byte swap functions work correctly" << std::endl;
+}
+
+void testConvertByteOrder() {
+    std::cout << "Testing bulk byte order conversion..." << std::endl;
+
+    const ByteOrder native = getByteOrder();
+    const ByteOrder foreign = getOppositeByteOrder(native);
+    const std::vector<uint32_t> values{0x01020304, 0xa1b2c3d4, 0xdeadbeef};
+
+    // Matching orders copy unchanged; the same buffer is left alone
+    std::vector<uint32_t> copy(values.size());
+    convertByteOrder(values.data(), copy.data(), values.size(), native, native);
+    assert(copy == values);
+    convertByteOrder(copy.data(), copy.data(), copy.size(), native, native);
+    assert(copy == values);
+    convertByteOrderInPlace(copy.data(), copy.size(), ByteOrder::unknown, foreign);
+    assert(copy == values);
+
+    // Differing orders swap every element
+    convertByteOrder(values.data(), copy.data(), values.size(), native, foreign);
+    for (size_t i = 0; i < values.size(); ++i) {
+        assert(copy[i] == byteSwap(values[i]));
+    }
+    convertByteOrderInPlace(copy.data(), copy.size(), foreign, native);
+    assert(copy == values);
+
+    // Network order is big-endian
+    std::vector<uint16_t> ports{80, 443};
+    std::vector<uint16_t> wire(ports.size());
+    hostToNetwork(ports.data(), wire.data(), ports.size());
+    for (size_t i = 0; i < ports.size(); ++i) {
+        assert(wire[i] == hostToNetwork(ports[i]));
+    }
+    networkToHost(wire.data(), wire.data(), wire.size());
+    assert(wire == ports);
+
+#if defined(__cpp_lib_span)
+    // Identity conversion returns the input itself without touching the output
+    std::vector<uint32_t> scratch(values.size(), 0);
+    std::span<const uint32_t> view =
+        convertByteOrder<uint32_t>(values, scratch, ByteOrder::big_endian, ByteOrder::big_endian);
+    assert(view.data() == values.data());
+    assert(view.size() == values.size());
+    assert(scratch[0] == 0);
+
+    view = convertByteOrder<uint32_t>(values, scratch, native, foreign);
+    assert(view.data() == scratch.data());
+    assert(view.size() == values.size());
+    assert(view[1] == byteSwap(values[1]));
+
+    // A short output limits the conversion
+    const std::span<uint32_t> short_output = std::span<uint32_t>(scratch).first(2);
+    view = convertByteOrder<uint32_t>(values, short_output, native, foreign);
+    assert(view.size() == 2);
+
+    convertByteOrderInPlace(std::span<uint32_t>(scratch), foreign, native);
+    assert(scratch == values);
+#endif
+
+    std::cout << "  ✓ Bulk conversion skips work when byte orders match" << std::endl;
+}
+
+enum class Tag : uint16_t { request = 0x0102, response = 0x0304 };
+
+void testExtendedTypes() {
+    std::cout << "Testing bulk conversion of floats, enums and 128-bit integers..." << std::endl;
+
+    const ByteOrder native = getByteOrder();
+    const ByteOrder foreign = getOppositeByteOrder(native);
+
+    std::vector<double> samples(100);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = 0.5 * static_cast<double>(i) - 3.25;
+    }
+    std::vector<double> wire(samples.size());
+    convertByteOrder(samples.data(), wire.data(), samples.size(), native, foreign);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        assert(std::memcmp(&wire[i], &samples[i], sizeof(double)) != 0 || samples[i] == 0.0);
+        const double swapped = byteSwap(samples[i]);
+        assert(std::memcmp(&wire[i], &swapped, sizeof(double)) == 0);
+    }
+    convertByteOrderInPlace(wire.data(), wire.size(), foreign, native);
+    assert(wire == samples);
+
+    std::vector<float> readings{1.5f, -2.0f, 1e-3f};
+    std::vector<float> network(readings.size());
+    hostToNetwork(readings.data(), network.data(), readings.size());
+    networkToHost(network.data(), network.data(), network.size());
+    assert(network == readings);
+
+    std::vector<Tag> tags{Tag::request, Tag::response};
+    byteSwapInPlace(tags.data(), tags.size());
+    assert(static_cast<uint16_t>(tags[0]) == 0x0201);
+    assert(static_cast<uint16_t>(tags[1]) == 0x0403);
+
+#if TRLC_HAS_INT128
+    using Hash = detail::Uint128;
+    std::vector<Hash> hashes(37);
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        hashes[i] = (static_cast<Hash>(i * 0x9E3779B97F4A7C15ull) << 64) | (i + 1);
+    }
+    std::vector<Hash> swapped_hashes(hashes.size());
+    byteSwapCopy(hashes.data(), swapped_hashes.data(), hashes.size());
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        assert(swapped_hashes[i] == byteSwap(hashes[i]));
+    }
+    byteSwapInPlace(swapped_hashes.data(), swapped_hashes.size());
+    assert(swapped_hashes == hashes);
+#endif
+
+    std::cout << "  ✓ Non-integer elements convert like integers of their size" << std::endl;
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Bulk Byte Swap Tests ===" << std::endl;
+
+    try {
+        testKernels();
+        testPublicInterface();
+        testConvertByteOrder();
+        testExtendedTypes();
+
+        std::cout << "\n✅ All bulk byte swap tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
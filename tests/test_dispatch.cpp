@@ -0,0 +1,182 @@
+/**
+ * @file test_dispatch.cpp
+ * @brief Tests for runtime implementation dispatch
+ *
+ * Tests candidate selection order, feature requirement matching, explicit
+ * feature bitmaps, the call path of the resolved function pointer and the
+ * functions defined with TRLC_DISPATCH_FUNCTION.
+ */
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "trlc/platform/dispatch.hpp"
+
+namespace trlc::platform::test {
+
+int implementationWide(int value) {
+    return value * 4;
+}
+
+int implementationNarrow(int value) {
+    return value * 2;
+}
+
+int implementationScalar(int value) {
+    return value;
+}
+
+using Kernel = Dispatch<int(int)>;
+
+TRLC_DISPATCH_FUNCTION(int,
+                       dispatchedScale,
+                       (int value),
+                       (value),
+                       {implementationWide, x86LevelFeatureMask(X86Level::v3), "x86-64-v3"},
+                       {implementationScalar, 0, "scalar"});
+
+/// Resolver for LazyDispatch that counts how often it is asked
+struct CountingResolver {
+    static inline int resolutions = 0;
+
+    static int (*resolve() noexcept)(int) {
+        ++resolutions;
+        return &implementationNarrow;
+    }
+};
+
+void testSelectsFirstSupportedCandidate() {
+    std::cout << "Testing candidate selection order..." << std::endl;
+
+    const uint64_t wide = runtimeFeatureMask({RuntimeFeature::avx2, RuntimeFeature::fma});
+    const uint64_t narrow = runtimeFeatureMask({RuntimeFeature::sse4_2});
+
+    Kernel all{{{implementationWide, wide, "wide"},
+                {implementationNarrow, narrow, "narrow"},
+                {implementationScalar, 0, "scalar"}},
+               wide | narrow};
+    assert(std::strcmp(all.name(), "wide") == 0);
+    assert(all(3) == 12);
+
+    Kernel partial{{{implementationWide, wide, "wide"},
+                    {implementationNarrow, narrow, "narrow"},
+                    {implementationScalar, 0, "scalar"}},
+                   narrow | runtimeFeatureMask({RuntimeFeature::avx2})};
+    assert(std::strcmp(partial.name(), "narrow") == 0);
+    assert(partial(3) == 6);
+
+    Kernel none{{{implementationWide, wide, "wide"},
+                 {implementationNarrow, narrow, "narrow"},
+                 {implementationScalar, 0, "scalar"}},
+                0};
+    assert(std::strcmp(none.name(), "scalar") == 0);
+    assert(none.get() == &implementationScalar);
+    assert(none(3) == 3);
+
+    std::cout << "  ✓ First candidate with all required features is selected" << std::endl;
+}
+
+void testNoMatchingCandidate() {
+    std::cout << "Testing dispatch without a matching candidate..." << std::endl;
+
+    Kernel empty{{{implementationWide, runtimeFeatureMask({RuntimeFeature::avx512f}), "wide"}}, 0};
+    assert(!empty);
+    assert(empty.get() == nullptr);
+    assert(std::strcmp(empty.name(), "none") == 0);
+
+    std::cout << "  ✓ Unresolved dispatch is reported" << std::endl;
+}
+
+void testResolvesAgainstCpu() {
+    std::cout << "Testing dispatch against the running CPU..." << std::endl;
+
+    static const Kernel kernel{
+        {implementationWide, x86LevelFeatureMask(X86Level::v3), "x86-64-v3"},
+        {implementationNarrow, runtimeFeatureMask({RuntimeFeature::neon}), "neon"},
+        {implementationScalar, 0, "scalar"}};
+    assert(kernel);
+
+    std::cout << "  - Selected: " << kernel.name() << std::endl;
+    if (getX86Level() >= X86Level::v3) {
+        assert(kernel(5) == 20);
+    } else if (hasNeonSupport()) {
+        assert(kernel(5) == 10);
+    } else {
+        assert(kernel(5) == 5);
+    }
+
+    std::cout << "  ✓ Dispatch follows the detected CPU features" << std::endl;
+}
+
+void testArgumentForwarding() {
+    std::cout << "Testing argument forwarding..." << std::endl;
+
+    struct Local {
+        static void append(std::string& out, const char* text) { out += text; }
+    };
+
+    Dispatch<void(std::string&, const char*)> append{{Local::append, 0, "scalar"}};
+    std::string result;
+    append(result, "abc");
+    append(result, "def");
+    assert(result == "abcdef");
+
+    std::cout << "  ✓ Reference arguments reach the implementation" << std::endl;
+}
+
+void testDispatchFunction() {
+    std::cout << "Testing TRLC_DISPATCH_FUNCTION..." << std::endl;
+    std::cout << "  - Backend: " << (TRLC_PLATFORM_HAS_IFUNC ? "ifunc" : "cached pointer")
+              << std::endl;
+
+    // The defined function calls the implementation Dispatch would select
+    Kernel reference{{implementationWide, x86LevelFeatureMask(X86Level::v3), "x86-64-v3"},
+                     {implementationScalar, 0, "scalar"}};
+    assert(dispatchedScale(7) == reference(7));
+    assert(dispatchedScale(7) == reference(7));
+
+    std::cout << "  ✓ Dispatched function forwards to the selected implementation" << std::endl;
+}
+
+void testLazyDispatchResolvesOnce() {
+    std::cout << "Testing self-resolving function pointer..." << std::endl;
+
+    using Lazy = detail::LazyDispatch<int(int), CountingResolver>;
+    assert(Lazy::target.load() == &Lazy::resolveAndCall);
+
+    assert(Lazy::target.load()(4) == 8);
+    assert(Lazy::target.load()(5) == 10);
+    assert(Lazy::target.load() == &implementationNarrow);
+    assert(CountingResolver::resolutions == 1);
+
+    std::cout << "  ✓ Resolver runs only on the first call" << std::endl;
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Dispatch Tests ===" << std::endl;
+
+    try {
+        testSelectsFirstSupportedCandidate();
+        testNoMatchingCandidate();
+        testResolvesAgainstCpu();
+        testArgumentForwarding();
+        testDispatchFunction();
+        testLazyDispatchResolvesOnce();
+
+        std::cout << "\n✅ All dispatch tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,320 @@
+/**
+ * @file test_endian_buffer.cpp
+ * @brief Tests for endian-aware buffer loads and stores
+ *
+ * Checks the byte layout produced and consumed by loadBE/loadLE/storeBE/
+ * storeLE for every width at every offset, agreement between the run-time
+ * and byte-wise paths, and use in constant expressions. The EndianValue
+ * wrappers are checked for layout and for overlaying a wire struct.
+ */
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+#include "trlc/platform/endian_buffer.hpp"
+
+namespace trlc::platform::test {
+
+/// Buffer holding 0x01, 0x02, ... so the expected value of any field is known
+std::array<std::byte, 32> countingBuffer() {
+    std::array<std::byte, 32> buffer{};
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<std::byte>(i + 1);
+    }
+    return buffer;
+}
+
+template <typename Type>
+void checkLoads() {
+    const auto buffer = countingBuffer();
+    for (size_t offset = 0; offset + sizeof(Type) <= buffer.size(); ++offset) {
+        uint64_t big = 0;
+        uint64_t little = 0;
+        for (size_t i = 0; i < sizeof(Type); ++i) {
+            big = (big << 8) | (offset + i + 1);
+            little |= uint64_t(offset + i + 1) << (8 * i);
+        }
+        assert(loadBE<Type>(buffer.data() + offset) == static_cast<Type>(big));
+        assert(loadLE<Type>(buffer.data() + offset) == static_cast<Type>(little));
+        assert(detail::loadBytes<Type>(buffer.data() + offset, true) == static_cast<Type>(big));
+        assert(detail::loadBytes<Type>(buffer.data() + offset, false) ==
+               static_cast<Type>(little));
+    }
+}
+
+template <typename Type>
+void checkStores() {
+    const auto expected = countingBuffer();
+    for (size_t offset = 0; offset + sizeof(Type) <= expected.size(); ++offset) {
+        const Type value = loadBE<Type>(expected.data() + offset);
+
+        std::array<std::byte, 32> big{};
+        std::array<std::byte, 32> little{};
+        storeBE(big.data() + offset, value);
+        storeLE(little.data() + offset, byteSwap(value));
+        for (size_t i = 0; i < big.size(); ++i) {
+            const bool inside = i >= offset && i < offset + sizeof(Type);
+            assert(big[i] == (inside ? expected[i] : std::byte{0}));
+            assert(little[i] == big[i]);
+        }
+    }
+}
+
+void testLoads() {
+    std::cout << "Testing loads at every offset..." << std::endl;
+
+    checkLoads<uint8_t>();
+    checkLoads<uint16_t>();
+    checkLoads<uint32_t>();
+    checkLoads<uint64_t>();
+    checkLoads<int16_t>();
+    checkLoads<int32_t>();
+    checkLoads<int64_t>();
+
+    // Sign bits survive the round trip through the unsigned representation
+    const std::byte negative[4] = {std::byte{0xff}, std::byte{0xff}, std::byte{0xff},
+                                   std::byte{0xfe}};
+    assert(loadBE<int32_t>(negative) == -2);
+    assert(loadLE<int16_t>(negative) == -1);
+
+    std::cout << "  ✓ Big- and little-endian loads match the byte layout" << std::endl;
+}
+
+void testStores() {
+    std::cout << "Testing stores at every offset..." << std::endl;
+
+    checkStores<uint16_t>();
+    checkStores<uint32_t>();
+    checkStores<uint64_t>();
+    checkStores<int32_t>();
+
+    // Stores touch exactly sizeof(Type) bytes
+    unsigned char guard[6] = {0xaa, 0, 0, 0, 0, 0xaa};
+    storeBE<uint32_t>(guard + 1, 0x11223344);
+    assert(guard[0] == 0xaa && guard[5] == 0xaa);
+    assert(guard[1] == 0x11 && guard[4] == 0x44);
+    storeLE<uint32_t>(guard + 1, 0x11223344);
+    assert(guard[1] == 0x44 && guard[4] == 0x11);
+
+    std::cout << "  ✓ Stores write the expected bytes and nothing else" << std::endl;
+}
+
+void testPacketHeader() {
+    std::cout << "Testing a packet header round trip..." << std::endl;
+
+    // type (u8), length (u32 BE) at offset 1, sequence (u64 BE) at 5, crc (u16 LE) at 13
+    char packet[15] = {};
+    storeBE<uint8_t>(packet, 7);
+    storeBE<uint32_t>(packet + 1, 1500);
+    storeBE<uint64_t>(packet + 5, 0x0102030405060708ull);
+    storeLE<uint16_t>(packet + 13, 0xbeef);
+
+    assert(packet[1] == 0 && packet[4] == static_cast<char>(1500 & 0xff));
+    assert(packet[5] == 1 && packet[12] == 8);
+    assert(static_cast<unsigned char>(packet[13]) == 0xef);
+
+    assert(loadBE<uint8_t>(packet) == 7);
+    assert(loadBE<uint32_t>(packet + 1) == 1500);
+    assert(loadBE<uint64_t>(packet + 5) == 0x0102030405060708ull);
+    assert(loadLE<uint16_t>(packet + 13) == 0xbeef);
+
+    std::cout << "  ✓ Unaligned header fields round-trip" << std::endl;
+}
+
+constexpr uint32_t constexprRoundTrip() {
+    std::byte buffer[7] = {};
+    storeBE<uint32_t>(buffer + 1, 0xcafef00d);
+    storeLE<uint16_t>(buffer + 5, 0x1234);
+    return loadBE<uint32_t>(buffer + 1) ^ loadLE<uint16_t>(buffer + 5) ^
+           (loadLE<uint32_t>(buffer + 1) == 0x0df0feca ? 1u : 0u);
+}
+
+void testCompileTime() {
+    std::cout << "Testing compile-time evaluation..." << std::endl;
+
+    constexpr std::byte header[4] = {std::byte{0x12}, std::byte{0x34}, std::byte{0x56},
+                                     std::byte{0x78}};
+    static_assert(loadBE<uint32_t>(header) == 0x12345678);
+    static_assert(loadLE<uint32_t>(header) == 0x78563412);
+    static_assert(loadBE<uint16_t>(header + 2) == 0x5678);
+    static_assert(constexprRoundTrip() == (0xcafef00d ^ 0x1234 ^ 1u));
+
+    // The same call at run time takes the word-access path
+    assert(constexprRoundTrip() == (0xcafef00d ^ 0x1234 ^ 1u));
+
+    std::cout << "  ✓ Loads and stores work in constant expressions" << std::endl;
+}
+
+struct WireHeader {
+    uint8_t type;
+    UnalignedBigEndian<uint32_t> length;
+    UnalignedBigEndian<uint64_t> sequence;
+    UnalignedLittleEndian<uint16_t> checksum;
+};
+
+static_assert(sizeof(WireHeader) == 15);
+static_assert(alignof(WireHeader) == 1);
+static_assert(std::is_trivially_copyable_v<WireHeader>);
+static_assert(std::is_standard_layout_v<WireHeader>);
+
+static_assert(sizeof(BigEndian<uint32_t>) == sizeof(uint32_t));
+static_assert(alignof(BigEndian<uint32_t>) == alignof(uint32_t));
+static_assert(alignof(UnalignedLittleEndian<uint64_t>) == 1);
+static_assert(std::is_trivially_copyable_v<LittleEndian<int64_t>>);
+static_assert(std::is_trivially_default_constructible_v<BigEndian<uint16_t>>);
+
+void testEndianValue() {
+    std::cout << "Testing EndianValue wrappers..." << std::endl;
+
+    // Stored bytes follow the declared order regardless of the host
+    BigEndian<uint32_t> big = 0x11223344;
+    LittleEndian<uint32_t> little = 0x11223344;
+    assert(big.bytes()[0] == std::byte{0x11} && big.bytes()[3] == std::byte{0x44});
+    assert(little.bytes()[0] == std::byte{0x44} && little.bytes()[3] == std::byte{0x11});
+    assert(big == 0x11223344u && little.value() == 0x11223344u);
+
+    big = 7;
+    const uint32_t sum = big + 1;
+    assert(sum == 8);
+
+    BigEndian<int16_t> negative = -300;
+    assert(negative == -300);
+
+    // Overlay a struct on a received buffer and edit it in place
+    unsigned char packet[1 + sizeof(WireHeader)] = {};
+    storeBE<uint32_t>(packet + 2, 1500);
+    storeBE<uint64_t>(packet + 6, 42);
+    storeLE<uint16_t>(packet + 14, 0xbeef);
+
+    auto* header = reinterpret_cast<WireHeader*>(packet + 1);
+    assert(header->length == 1500u);
+    assert(header->sequence == 42u);
+    assert(header->checksum == 0xbeef);
+
+    header->sequence = header->sequence + 1;
+    assert(loadBE<uint64_t>(packet + 6) == 43);
+
+    std::cout << "  ✓ Wrappers store the declared byte order and overlay wire data" << std::endl;
+}
+
+enum class Opcode : uint16_t { read = 0x0001, write = 0x0102 };
+
+void testExtendedTypes() {
+    std::cout << "Testing floats, enums and 128-bit fields..." << std::endl;
+
+    unsigned char buffer[1 + 8 + 4 + 2] = {};
+    storeBE<double>(buffer + 1, -1.5);
+    storeLE<float>(buffer + 9, 0.25f);
+    storeBE(buffer + 13, Opcode::write);
+
+    // IEEE 754 -1.5 is 0xBFF8000000000000
+    assert(buffer[1] == 0xbf && buffer[2] == 0xf8 && buffer[8] == 0);
+    assert(loadBE<uint64_t>(buffer + 1) == 0xbff8000000000000ull);
+    assert(loadBE<double>(buffer + 1) == -1.5);
+    assert(loadLE<float>(buffer + 9) == 0.25f);
+    assert(loadBE<Opcode>(buffer + 13) == Opcode::write);
+    assert(buffer[13] == 0x01 && buffer[14] == 0x02);
+
+    UnalignedBigEndian<double> temperature = 21.5;
+    LittleEndian<Opcode> opcode = Opcode::read;
+    assert(temperature == 21.5);
+    assert(opcode == Opcode::read);
+    assert(opcode.bytes()[0] == std::byte{0x01});
+
+#if TRLC_HAS_INT128
+    std::byte hash_bytes[17] = {};
+    const auto hash = static_cast<detail::Uint128>(0x0102030405060708ull) << 64 | 0x090a;
+    storeBE(hash_bytes + 1, hash);
+    assert(hash_bytes[1] == std::byte{0x01} && hash_bytes[16] == std::byte{0x0a});
+    assert(loadBE<detail::Uint128>(hash_bytes + 1) == hash);
+    static_assert(sizeof(BigEndian<detail::Uint128>) == 16);
+#endif
+
+    std::cout << "  ✓ Extended types load, store and wrap like integers" << std::endl;
+}
+
+template <typename Type, typename Bits>
+void checkBitExactRoundTrip(Bits host_bits) {
+    Type value;
+    std::memcpy(&value, &host_bits, sizeof(Type));
+
+    unsigned char big[sizeof(Type)] = {};
+    unsigned char little[sizeof(Type)] = {};
+    storeBE(big, value);
+    storeLE(little, value);
+    assert(loadBE<Bits>(big) == host_bits);
+    assert(loadLE<Bits>(little) == host_bits);
+
+    const Type loaded[] = {loadBE<Type>(big), loadLE<Type>(little),
+                           BigEndian<Type>(value).value(), LittleEndian<Type>(value).value()};
+    for (const Type& result : loaded) {
+        Bits bits;
+        std::memcpy(&bits, &result, sizeof(Type));
+        assert(bits == host_bits);
+    }
+}
+
+void testSignallingNanPayload() {
+    std::cout << "Testing floats whose swapped form is a signalling NaN..." << std::endl;
+
+    // Byte-swapped, these are the signalling NaNs 0x7f800001 and
+    // 0x7ff0000000000001; whichever store swaps on this host must carry the
+    // pattern through unchanged rather than quieting it
+    checkBitExactRoundTrip<float>(uint32_t{0x0100807f});
+    checkBitExactRoundTrip<double>(uint64_t{0x010000000000f07full});
+
+    // Signalling NaNs in host order survive as well
+    checkBitExactRoundTrip<float>(uint32_t{0x7f800001});
+    checkBitExactRoundTrip<double>(uint64_t{0x7ff0000000000001ull});
+
+    std::cout << "  ✓ Float bit patterns round-trip exactly" << std::endl;
+}
+
+constexpr uint64_t constexprWrapper() {
+    BigEndian<uint64_t> value = 0x0102030405060708ull;
+    return value;
+}
+
+void testEndianValueCompileTime() {
+    std::cout << "Testing EndianValue in constant expressions..." << std::endl;
+
+    constexpr LittleEndian<uint16_t> constant = 0xabcd;
+    static_assert(constant == 0xabcd);
+    static_assert(constexprWrapper() == 0x0102030405060708ull);
+
+    std::cout << "  ✓ Wrappers work in constant expressions" << std::endl;
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Endian Buffer Tests ===" << std::endl;
+
+    try {
+        testLoads();
+        testStores();
+        testPacketHeader();
+        testCompileTime();
+        testEndianValue();
+        testEndianValueCompileTime();
+        testExtendedTypes();
+        testSignallingNanPayload();
+
+        std::cout << "\n✅ All endian buffer tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
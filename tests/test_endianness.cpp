@@ -8,6 +8,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 
 #include "trlc/platform/endianness.hpp"
@@ -168,6 +169,46 @@ void testGenericByteSwap() {
     std::cout << "  ✓ Generic byte swap template works correctly" << std::endl;
 }
 
+enum class MessageType : uint32_t { hello = 0x11223344, goodbye = 0xA0B0C0D0 };
+
+void testExtendedTypeByteSwap() {
+    std::cout << "Testing byte swap of floats, enums and 128-bit integers..." << std::endl;
+
+    // Floating point values swap their bit pattern and round-trip exactly
+    const float pi = 3.14159f;
+    const float swapped_pi = byteSwap(pi);
+    uint32_t pi_bits = 0;
+    uint32_t swapped_pi_bits = 0;
+    std::memcpy(&pi_bits, &pi, sizeof(pi));
+    std::memcpy(&swapped_pi_bits, &swapped_pi, sizeof(swapped_pi));
+    assert(swapped_pi_bits == byteSwap(pi_bits));
+    assert(byteSwap(swapped_pi) == pi);
+
+    const double e = 2.718281828459045;
+    assert(networkToHost(hostToNetwork(e)) == e);
+    assert(convertByteOrder(convertByteOrder(e, ByteOrder::little_endian, ByteOrder::big_endian),
+                            ByteOrder::big_endian,
+                            ByteOrder::little_endian) == e);
+
+    // Enumerations swap their underlying value
+    assert(byteSwap(MessageType::hello) == static_cast<MessageType>(0x44332211));
+    assert(networkToHost(hostToNetwork(MessageType::goodbye)) == MessageType::goodbye);
+
+#if TRLC_HAS_INT128
+    const detail::Uint128 hash = (static_cast<detail::Uint128>(0x0102030405060708ULL) << 64) |
+                                 0x090A0B0C0D0E0F10ULL;
+    const detail::Uint128 swapped_hash = byteSwap(hash);
+    assert(static_cast<uint64_t>(swapped_hash) == 0x0807060504030201ULL);
+    assert(static_cast<uint64_t>(swapped_hash >> 64) == 0x100F0E0D0C0B0A09ULL);
+    assert(byteSwap(swapped_hash) == hash);
+
+    const detail::Int128 negative = -2;
+    assert(byteSwap(byteSwap(negative)) == negative);
+#endif
+
+    std::cout << "  ✓ Extended type byte swap works correctly" << std::endl;
+}
+
 void testNetworkByteOrder() {
     std::cout << "Testing network byte order conversion..." << std::endl;
 
@@ -335,6 +376,20 @@ void testCompileTimeExecution() {
     constexpr uint16_t back16 = networkToHost(net16);
     static_assert(back16 == test16, "network conversion should work at compile time");
 
+    // Test compile-time byte swap of enumerations and extended types
+    static_assert(byteSwap(MessageType::hello) == static_cast<MessageType>(0x44332211),
+                  "enum byteSwap should work at compile time");
+#if TRLC_HAS_CONSTEXPR_BIT_CAST
+    static_assert(byteSwap(byteSwap(1.25)) == 1.25, "double byteSwap should work at compile time");
+    static_assert(networkToHost(hostToNetwork(-0.5f)) == -0.5f,
+                  "float conversion should work at compile time");
+#endif
+#if TRLC_HAS_INT128
+    static_assert(byteSwap(static_cast<detail::Uint128>(0xAB)) ==
+                      static_cast<detail::Uint128>(0xAB) << 120,
+                  "128-bit byteSwap should work at compile time");
+#endif
+
     // Test compile-time endianness info (may not be fully constexpr due to runtime fallback)
     auto info = getEndiannessInfo();
     static_cast<void>(info);  // Use to prevent optimization
@@ -430,6 +485,7 @@ int main() {
         testEndiannessInfo();
         testByteSwapping();
         testGenericByteSwap();
+        testExtendedTypeByteSwap();
         testNetworkByteOrder();
         testUtilityFunctions();
         testMacros();
@@ -5,6 +5,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <string>
 
 #include "trlc/platform/features.hpp"
 
@@ -74,6 +75,144 @@ void testRuntimeFeatures() {
     std::cout << "  ✓ Runtime features tested" << std::endl;
 }
 
+void testRuntimeFeatureCache() {
+    std::cout << "Testing cached runtime feature bitmap..." << std::endl;
+
+    // The first query populates the bitmap; it must stay stable afterwards
+    uint64_t first = detail::cpuFeatureBits();
+    uint64_t second = detail::cpuFeatureBits();
+    assert(first == second);
+    assert((first & detail::CPU_FEATURES_VALID_BIT) != 0);
+
+    // Every query must agree with the cached bitmap
+    for (int i = 0; i < RUNTIME_FEATURE_COUNT; ++i) {
+        auto feature = static_cast<RuntimeFeature>(i);
+        bool cached = (first & detail::runtimeFeatureBit(feature)) != 0;
+        assert(hasRuntimeFeature(feature) == cached);
+    }
+
+    // Out-of-range values never map onto a bitmap bit
+    assert(detail::runtimeFeatureBit(static_cast<RuntimeFeature>(999)) == 0);
+    assert(!hasRuntimeFeature(static_cast<RuntimeFeature>(999)));
+
+#if TRLC_HAS_X86_INTRINSICS
+    // Cached answers must match a direct CPUID query
+    assert(hasSse2Support() == detail::checkCpuFeature(1, 0, 3, 26));
+    assert(hasSse42Support() == detail::checkCpuFeature(1, 0, 2, 20));
+#endif
+
+    std::cout << "  ✓ Runtime feature bitmap is cached and consistent" << std::endl;
+}
+
+void testExtendedIsaFeatures() {
+    std::cout << "Testing extended ISA features..." << std::endl;
+
+    for (int i = 0; i < RUNTIME_FEATURE_COUNT; ++i) {
+        auto feature = static_cast<RuntimeFeature>(i);
+        assert(std::string(runtimeFeatureName(feature)) != "Unknown");
+        if (hasRuntimeFeature(feature)) {
+            std::cout << "  - " << runtimeFeatureName(feature) << ": yes" << std::endl;
+        }
+    }
+
+    // Extensions that extend AVX or AVX-512 state imply their base feature
+    if (hasFmaSupport() || hasF16cSupport() || hasVaesSupport() || hasAvxVnniSupport()) {
+        assert(hasAvxSupport());
+    }
+    if (hasAvx512bwSupport() || hasAvx512dqSupport() || hasAvx512vlSupport() ||
+        hasAvx512vnniSupport() || hasAvx512vbmiSupport()) {
+        assert(hasAvx512fSupport());
+    }
+    if (hasAmxInt8Support() || hasAmxBf16Support()) {
+        assert(hasAmxTileSupport());
+    }
+
+#if TRLC_HAS_X86_INTRINSICS
+    assert(hasPopcntSupport() == detail::checkCpuFeature(1, 0, 2, 23));
+    assert(hasBmi2Support() == detail::checkCpuFeature(7, 0, 1, 8));
+    assert(!hasSveSupport() && !hasLseAtomicsSupport());
+#else
+    assert(!hasAvx512bwSupport() && !hasAmxTileSupport());
+#endif
+
+    // Convenience macros agree with the runtime query
+    assert(TRLC_HAS_FMA_RUNTIME() == hasFmaSupport());
+    assert(TRLC_HAS_AVX512BW_RUNTIME() == hasAvx512bwSupport());
+
+    std::cout << "  ✓ Extended ISA features are consistent" << std::endl;
+}
+
+void testX86Level() {
+    std::cout << "Testing x86-64 microarchitecture level..." << std::endl;
+
+    X86Level level = getX86Level();
+    assert(level == getX86Level());
+    std::cout << "  - Level: " << x86LevelName(level) << std::endl;
+
+    // Level masks are cumulative
+    static_assert((x86LevelFeatureMask(X86Level::v2) & x86LevelFeatureMask(X86Level::baseline)) ==
+                      x86LevelFeatureMask(X86Level::baseline),
+                  "v2 must include the baseline requirements");
+    static_assert((x86LevelFeatureMask(X86Level::v4) & x86LevelFeatureMask(X86Level::v3)) ==
+                      x86LevelFeatureMask(X86Level::v3),
+                  "v4 must include the v3 requirements");
+    static_assert(x86LevelFeatureMask(X86Level::none) == 0, "none has no requirements");
+
+    // The level is the highest one whose requirements are all present
+    uint64_t bits = detail::cpuFeatureBits();
+    assert(detail::x86LevelFromBits(bits) == level);
+    assert(hasAllRuntimeFeatures(x86LevelFeatureMask(level)));
+    if (level != X86Level::v4 && level != X86Level::none) {
+        auto next = static_cast<X86Level>(static_cast<int>(level) + 1);
+        assert(!hasAllRuntimeFeatures(x86LevelFeatureMask(next)));
+    }
+    if (level >= X86Level::v3) {
+        assert(hasAvx2Support() && hasFmaSupport() && hasBmi2Support());
+    }
+
+    // Synthetic bitmaps map onto the expected levels
+#if defined(__x86_64__) || defined(_M_X64)
+    assert(detail::x86LevelFromBits(0) == X86Level::none);
+    assert(detail::x86LevelFromBits(x86LevelFeatureMask(X86Level::v2)) == X86Level::v2);
+    assert(detail::x86LevelFromBits(x86LevelFeatureMask(X86Level::v4)) == X86Level::v4);
+    uint64_t v3_without_movbe = x86LevelFeatureMask(X86Level::v3) &
+                                ~runtimeFeatureMask({RuntimeFeature::movbe});
+    assert(detail::x86LevelFromBits(v3_without_movbe) == X86Level::v2);
+#else
+    assert(level == X86Level::none);
+#endif
+
+    std::cout << "  ✓ x86-64 level detection works correctly" << std::endl;
+}
+
+void testArmHwcapMapping() {
+    std::cout << "Testing AArch64 hardware capability mapping..." << std::endl;
+
+    // The translation is pure, so it can be checked on every host
+    static_assert(detail::armFeatureBitsFromHwcap(0, 0) == 0, "no capabilities, no features");
+    constexpr uint64_t graviton2 = detail::ARM_HWCAP_ASIMD | detail::ARM_HWCAP_AES |
+                                   detail::ARM_HWCAP_SHA2 | detail::ARM_HWCAP_CRC32 |
+                                   detail::ARM_HWCAP_ATOMICS | detail::ARM_HWCAP_ASIMDDP;
+    constexpr uint64_t bits = detail::armFeatureBitsFromHwcap(graviton2, 0);
+    static_assert((bits & detail::runtimeFeatureBit(RuntimeFeature::crc32)) != 0, "CRC32");
+    static_assert((bits & detail::runtimeFeatureBit(RuntimeFeature::lse_atomics)) != 0, "LSE");
+    static_assert((bits & detail::runtimeFeatureBit(RuntimeFeature::sve)) == 0, "no SVE");
+
+    constexpr uint64_t sve2_bits =
+        detail::armFeatureBitsFromHwcap(detail::ARM_HWCAP_SVE, detail::ARM_HWCAP2_SVE2);
+    static_assert(sve2_bits == runtimeFeatureMask({RuntimeFeature::sve, RuntimeFeature::sve2}),
+                  "SVE and SVE2");
+
+#if defined(__aarch64__) && defined(__linux__)
+    // Everything the kernel reports must show up in the cached bitmap
+    uint64_t reported = detail::armFeatureBitsFromHwcap(getauxval(AT_HWCAP), getauxval(AT_HWCAP2));
+    assert((detail::cpuFeatureBits() & reported) == reported);
+    std::cout << "  - AT_HWCAP: 0x" << std::hex << getauxval(AT_HWCAP) << std::dec << std::endl;
+#endif
+
+    std::cout << "  ✓ Hardware capabilities map onto runtime features" << std::endl;
+}
+
 void testSanitizerFeatures() {
     std::cout << "Testing sanitizer features..." << std::endl;
 
@@ -117,6 +256,65 @@ void testFeatureSet() {
     std::cout << "  ✓ FeatureSet works correctly" << std::endl;
 }
 
+void testOsEnabledVectorState() {
+    std::cout << "Testing OS-enabled AVX state detection..." << std::endl;
+
+#if TRLC_HAS_X86_INTRINSICS
+    uint32_t leaf1[4];
+    detail::cpuid(1, 0, leaf1);
+    bool has_osxsave = (leaf1[2] & (1u << 27)) != 0;
+    uint64_t xcr0 = has_osxsave ? detail::xgetbv(0) : 0;
+
+    std::cout << "  - OSXSAVE: " << (has_osxsave ? "yes" : "no") << std::endl;
+    std::cout << "  - XCR0: 0x" << std::hex << xcr0 << std::dec << std::endl;
+
+    // AVX family features are only reported when the OS saves YMM state
+    if (hasAvxSupport() || hasAvx2Support()) {
+        assert(has_osxsave);
+        assert((xcr0 & detail::XCR0_AVX_STATE) == detail::XCR0_AVX_STATE);
+    }
+    if (hasAvx512fSupport()) {
+        assert(hasAvxSupport());
+        assert(detail::isOsAvx512Enabled(xcr0));
+    }
+
+    // Without OS support the CPUID bit alone must not enable AVX
+    if (!has_osxsave || (xcr0 & detail::XCR0_AVX_STATE) != detail::XCR0_AVX_STATE) {
+        assert(!hasAvxSupport());
+        assert(!hasAvx2Support());
+        assert(!hasAvx512fSupport());
+    }
+#else
+    std::cout << "  - Not an x86 target, skipping" << std::endl;
+#endif
+
+    std::cout << "  ✓ AVX detection respects OS-enabled state" << std::endl;
+}
+
+void testRuntimeFeatureSet() {
+    std::cout << "Testing runtime FeatureSet..." << std::endl;
+
+    FeatureSet runtime = getRuntimeFeatureSet();
+    FeatureSet compile_time = getFeatureSet();
+
+    // Language features are identical in both sets
+    assert(runtime.has_exceptions == compile_time.has_exceptions);
+    assert(runtime.has_rtti == compile_time.has_rtti);
+    assert(runtime.has_threads == compile_time.has_threads);
+
+    // Runtime fields reflect the detected CPU features
+    for (int i = 0; i < RUNTIME_FEATURE_COUNT; ++i) {
+        auto feature = static_cast<RuntimeFeature>(i);
+        assert(runtime.hasRuntimeFeature(feature) == hasRuntimeFeature(feature));
+    }
+    assert(runtime.has_sse2 == hasSse2Support());
+    assert(runtime.has_avx2 == hasAvx2Support());
+
+    std::cout << "  - SSE2: " << (runtime.has_sse2 ? "yes" : "no") << std::endl;
+    std::cout << "  - AVX2: " << (runtime.has_avx2 ? "yes" : "no") << std::endl;
+    std::cout << "  ✓ Runtime FeatureSet matches CPU detection" << std::endl;
+}
+
 void testMacros() {
     std::cout << "Testing feature detection macros..." << std::endl;
 
@@ -228,8 +426,14 @@ int main() {
     try {
         testLanguageFeatures();
         testRuntimeFeatures();
+        testRuntimeFeatureCache();
+        testOsEnabledVectorState();
+        testExtendedIsaFeatures();
+        testX86Level();
+        testArmHwcapMapping();
         testSanitizerFeatures();
         testFeatureSet();
+        testRuntimeFeatureSet();
         testMacros();
         testCompileTimeDetection();
         testEdgeCases();
@@ -177,8 +177,43 @@ void testDetectionConsistency() {
     assert(features.has_exceptions == report.features.has_exceptions);
     assert(features.has_rtti == report.features.has_rtti);
     assert(features.has_threads == report.features.has_threads);
+
+    // Runtime CPU features in the report come from the detected CPU
+    auto runtime_features = getRuntimeFeatureSet();
+    assert(runtime_features.has_sse2 == report.features.has_sse2);
+    assert(runtime_features.has_avx2 == report.features.has_avx2);
+    assert(report.features.has_neon == hasNeonSupport());
     std::cout << "  - Feature detection consistent across methods" << std::endl;
 
+    // The reported microarchitecture level is the cached query result
+    assert(report.x86_level == getX86Level());
+    assert(hasAllRuntimeFeatures(x86LevelFeatureMask(report.x86_level)));
+    std::cout << "  - x86-64 level consistent across methods" << std::endl;
+
+    // The reported cache hierarchy is the cached runtime detection
+    assert(report.caches.caches.size() == getCacheTopology().caches.size());
+    assert(report.caches.l1DataSize() == getCacheTopology().l1DataSize());
+    std::cout << "  - Cache hierarchy consistent across methods" << std::endl;
+
+    // The reported processor topology is the cached runtime detection
+    assert(report.topology.logicalCpuCount() == getCpuTopology().logicalCpuCount());
+    assert(report.topology.core_count == getCpuTopology().core_count);
+    std::cout << "  - CPU topology consistent across methods" << std::endl;
+
+    // The reported CPU budget is the cached one
+    assert(report.cpu_budget.effective_cpus == getEffectiveCpuCount());
+    assert(report.cpu_budget.effective_cpus <= report.cpu_budget.online_cpus);
+    std::cout << "  - CPU budget consistent across methods" << std::endl;
+
+    // The reported memory budget is the cached one
+    assert(report.memory_budget.effective_bytes == getEffectiveMemoryLimit());
+    assert(report.memory_budget.limit_bytes == getMemoryBudget().limit_bytes);
+    std::cout << "  - Memory budget consistent across methods" << std::endl;
+
+    // Every node with CPUs is an online NUMA node
+    assert(report.numa.nodeCount() >= report.topology.node_count);
+    std::cout << "  - NUMA information consistent across methods" << std::endl;
+
     std::cout << "  ✓ Detection consistency validation passed" << std::endl;
 }
 
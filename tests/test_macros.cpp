@@ -42,6 +42,16 @@ TRLC_INLINE int testInlineFunction() {
     return 300;
 }
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+TRLC_TARGET("sse2") int testTargetFunction() {
+    return 400;
+}
+#else
+int testTargetFunction() {
+    return 400;
+}
+#endif
+
 // Test functions for exception safety
 void testNoexceptFunction() TRLC_NOEXCEPT {
     // This function claims not to throw
@@ -144,6 +154,9 @@ void testBasicMacros() {
     result = testInlineFunction();
     assert(result == 300);
 
+    result = testTargetFunction();
+    assert(result == 400);
+
     std::cout << "  ✓ Basic macros work correctly" << std::endl;
 }
 
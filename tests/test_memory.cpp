@@ -0,0 +1,162 @@
+/**
+ * @file test_memory.cpp
+ * @brief Tests for runtime memory page queries
+ *
+ * Tests the runtime page size, huge page pool discovery, transparent
+ * huge page policy parsing and huge page backed buffers.
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "trlc/platform/memory.hpp"
+
+namespace trlc::platform::test {
+
+void testRuntimePageSize() {
+    std::cout << "Testing runtime page size..." << std::endl;
+
+    size_t page_size = getRuntimePageSize();
+    std::cout << "  - Page size: " << page_size << " bytes" << std::endl;
+    std::cout << "  - Compile-time estimate: " << getPageSize() << " bytes" << std::endl;
+
+    assert(page_size >= 4096);
+    assert((page_size & (page_size - 1)) == 0);
+    assert(page_size == getRuntimePageSize());
+
+    std::cout << "  ✓ Runtime page size is valid" << std::endl;
+}
+
+void testTransparentModeParsing() {
+    std::cout << "Testing transparent huge page mode parsing..." << std::endl;
+
+    using detail::parseTransparentHugePageMode;
+    assert(parseTransparentHugePageMode("[always] madvise never") ==
+           TransparentHugePageMode::always);
+    assert(parseTransparentHugePageMode("always [madvise] never") ==
+           TransparentHugePageMode::madvise);
+    assert(parseTransparentHugePageMode("always madvise [never]") ==
+           TransparentHugePageMode::never);
+    assert(parseTransparentHugePageMode("") == TransparentHugePageMode::unavailable);
+
+    assert(std::string(transparentHugePageModeName(TransparentHugePageMode::madvise)) ==
+           "madvise");
+
+    std::cout << "  ✓ Transparent huge page modes are parsed correctly" << std::endl;
+}
+
+void testHugePageInfo() {
+    std::cout << "Testing huge page information..." << std::endl;
+
+    const HugePageInfo& info = getHugePageInfo();
+    assert(&info == &getHugePageInfo());  // Read once and cached
+
+    std::cout << "  - Default huge page size: " << info.default_page_size << " bytes"
+              << std::endl;
+    std::cout << "  - Transparent mode: " << transparentHugePageModeName(info.transparent_mode)
+              << std::endl;
+    for (const HugePagePool& pool : info.pools) {
+        std::cout << "  - Pool " << pool.page_size / 1024 << " KiB: " << pool.free_pages << "/"
+                  << pool.total_pages << " free" << std::endl;
+        assert(pool.page_size > getRuntimePageSize());
+        assert(pool.free_pages <= pool.total_pages);
+        assert(info.findPool(pool.page_size) == &pool);
+    }
+
+    // Pools are ordered by size
+    for (size_t i = 1; i < info.pools.size(); ++i) {
+        assert(info.pools[i - 1].page_size < info.pools[i].page_size);
+    }
+
+    if (info.default_page_size != 0 && !info.pools.empty()) {
+        assert(info.findPool(info.default_page_size) != nullptr);
+    }
+    assert(info.findPool(3) == nullptr);
+    assert(!info.hasFreePages(3));
+
+    // A fresh read sees the same configuration
+    HugePageInfo fresh = readHugePageInfo();
+    assert(fresh.pools.size() == info.pools.size());
+    assert(fresh.transparent_mode == info.transparent_mode);
+
+    std::cout << "  ✓ Huge page information is consistent" << std::endl;
+}
+
+void testHugePageBuffer() {
+    std::cout << "Testing huge page buffers..." << std::endl;
+
+    const size_t bytes = (size_t(4) << 20) + 123;
+    HugePageBuffer buffer(bytes);
+    assert(buffer);
+    std::cout << "  - Backing: " << hugePageBackingName(buffer.backing()) << " ("
+              << buffer.pageSize() / 1024 << " KiB pages)" << std::endl;
+
+    assert(buffer.size() == bytes);
+    assert(buffer.mappedSize() >= bytes);
+    assert(buffer.mappedSize() % buffer.pageSize() == 0);
+    assert(reinterpret_cast<uintptr_t>(buffer.data()) % buffer.pageSize() == 0);
+    assert(buffer.usesHugePages() == (buffer.backing() != HugePageBacking::normal));
+
+    // Zero-initialized and writable across the whole mapping
+    auto* bytes_view = static_cast<unsigned char*>(buffer.data());
+    assert(bytes_view[0] == 0 && bytes_view[bytes - 1] == 0);
+    std::memset(bytes_view, 0x5A, buffer.mappedSize());
+
+    // Falling back is reported, never hidden
+    const HugePageInfo& info = getHugePageInfo();
+    if (buffer.backing() == HugePageBacking::normal) {
+        assert(!info.isTransparentAvailable() || buffer.pageSize() == getRuntimePageSize());
+    }
+
+    HugePageBuffer normal(bytes, HugePageBacking::normal);
+    assert(normal.backing() == HugePageBacking::normal);
+    assert(normal.pageSize() == getRuntimePageSize());
+
+    HugePageBuffer transparent(bytes, HugePageBacking::transparent);
+    assert(transparent.backing() != HugePageBacking::explicit_pool);
+    if (info.isTransparentAvailable()) {
+        assert(transparent.backing() == HugePageBacking::transparent);
+        assert(reinterpret_cast<uintptr_t>(transparent.data()) % transparent.pageSize() == 0);
+    }
+
+    // Ownership moves with the buffer
+    void* data = buffer.data();
+    HugePageBuffer moved(std::move(buffer));
+    assert(moved.data() == data && !buffer);
+    buffer = std::move(moved);
+    assert(buffer.data() == data && !moved);
+
+    HugePageBuffer empty;
+    assert(!empty && empty.backing() == HugePageBacking::none);
+
+    std::cout << "  ✓ Huge page buffers are allocated with a reported backing" << std::endl;
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Memory Tests ===" << std::endl;
+
+    try {
+        testRuntimePageSize();
+        testTransparentModeParsing();
+        testHugePageInfo();
+        testHugePageBuffer();
+
+        std::cout << "\n✅ All memory tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,209 @@
+/**
+ * @file test_pool.cpp
+ * @brief Tests for the fixed-size object pool
+ *
+ * Tests block layout and reuse on one thread, object construction and
+ * destruction, cross-thread frees and the handover of thread caches when
+ * threads exit.
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "trlc/platform/pool.hpp"
+
+namespace trlc::platform::test {
+
+/// Counts live instances to check construction and destruction
+struct Message {
+    static inline int live = 0;
+
+    uint64_t sequence;
+    char payload[40];
+
+    explicit Message(uint64_t value) : sequence(value), payload{} {
+        if (value == UINT64_MAX) {
+            throw std::runtime_error("construction failed");
+        }
+        ++live;
+    }
+    ~Message() { --live; }
+};
+
+void testSingleThread() {
+    std::cout << "Testing single-threaded allocation..." << std::endl;
+
+    FixedSizePool pool(24, 16);
+    assert(pool.objectSize() == 32);
+    assert(pool.slabSize() >= FixedSizePool::MIN_SLAB_SIZE);
+    assert((pool.slabSize() & (pool.slabSize() - 1)) == 0);
+
+    std::set<void*> distinct;
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < 3 * pool.slabCapacity(); ++i) {
+        void* block = pool.allocate();
+        assert(isAligned(block, 16));
+        assert(distinct.insert(block).second);
+        blocks.push_back(block);
+    }
+    assert(pool.stats().slab_count == 3);
+
+    for (void* block : blocks) {
+        pool.deallocate(block);
+    }
+    pool.deallocate(nullptr);
+
+    // Freed blocks are reused without new slabs
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        assert(distinct.count(pool.allocate()) == 1);
+    }
+    const PoolStats stats = pool.stats();
+    assert(stats.slab_count == 3);
+    assert(stats.thread_caches == 1);
+    assert(stats.remote_frees == 0);
+    assert(stats.flushes > 0);
+    assert(stats.hits + stats.refills == 2 * blocks.size());
+    std::cout << "  - Hit rate: " << stats.hitRate() * 100.0 << "%, " << stats.refills
+              << " refills" << std::endl;
+    assert(stats.hitRate() > 0.9);
+
+    std::cout << "  ✓ Blocks are distinct, aligned and reused" << std::endl;
+}
+
+void testObjectPool() {
+    std::cout << "Testing ObjectPool..." << std::endl;
+
+    ObjectPool<Message> messages;
+    Message* first = messages.create(1);
+    Message* second = messages.create(2);
+    assert(first->sequence == 1 && second->sequence == 2);
+    assert(Message::live == 2);
+
+    messages.destroy(first);
+    assert(Message::live == 1);
+    assert(messages.create(3) == first);  // Most recently freed block first
+
+    bool threw = false;
+    try {
+        messages.create(UINT64_MAX);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(Message::live == 2);
+
+    messages.destroy(first);
+    messages.destroy(second);
+    messages.destroy(nullptr);
+    assert(Message::live == 0);
+
+    std::cout << "  ✓ Objects are constructed and destroyed in pooled blocks" << std::endl;
+}
+
+void testCrossThreadFrees() {
+    std::cout << "Testing cross-thread frees..." << std::endl;
+
+    ObjectPool<Message> messages;
+    constexpr size_t batch = 1000;
+    std::vector<Message*> produced;
+
+    for (int round = 0; round < 20; ++round) {
+        for (size_t i = 0; i < batch; ++i) {
+            produced.push_back(messages.create(i));
+        }
+        std::thread consumer([&] {
+            for (Message* message : produced) {
+                messages.destroy(message);
+            }
+        });
+        consumer.join();
+        produced.clear();
+    }
+    assert(Message::live == 0);
+
+    const PoolStats stats = messages.stats();
+    std::cout << "  - Remote frees: " << stats.remote_frees << ", slabs: " << stats.slab_count
+              << ", caches: " << stats.thread_caches << std::endl;
+    assert(stats.remote_frees == 20 * batch);
+
+    // Blocks freed remotely flow back, so the pool does not keep growing
+    const size_t needed = (batch + messages.pool().slabCapacity() - 1) /
+                          messages.pool().slabCapacity();
+    assert(stats.slab_count <= needed + 1);
+
+    // Exited consumers hand their cache to the next thread
+    assert(stats.thread_caches == 2);
+
+    std::cout << "  ✓ Blocks freed on other threads are reused" << std::endl;
+}
+
+void testConcurrentUse() {
+    std::cout << "Testing concurrent allocation..." << std::endl;
+
+    FixedSizePool pool(64, 64);
+    constexpr int thread_count = 4;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&pool, t] {
+            std::vector<uint64_t*> blocks;
+            for (int round = 0; round < 200; ++round) {
+                for (int i = 0; i < 100; ++i) {
+                    auto* block = static_cast<uint64_t*>(pool.allocate());
+                    *block = static_cast<uint64_t>(t);
+                    blocks.push_back(block);
+                }
+                for (uint64_t* block : blocks) {
+                    assert(*block == static_cast<uint64_t>(t));  // Never handed out twice
+                    pool.deallocate(block);
+                }
+                blocks.clear();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const PoolStats stats = pool.stats();
+    assert(stats.hits + stats.refills == thread_count * 200 * 100);
+    assert(stats.thread_caches <= thread_count);
+
+    // A pool destroyed and recreated does not reuse stale caches
+    for (int i = 0; i < 3; ++i) {
+        FixedSizePool scratch(16);
+        scratch.deallocate(scratch.allocate());
+        assert(scratch.stats().thread_caches == 1);
+    }
+
+    std::cout << "  ✓ Concurrent threads allocate without conflicts" << std::endl;
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Object Pool Tests ===" << std::endl;
+
+    try {
+        testSingleThread();
+        testObjectPool();
+        testCrossThreadFrees();
+        testConcurrentUse();
+
+        std::cout << "\n✅ All object pool tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,228 @@
+/**
+ * @file test_resources.cpp
+ * @brief Tests for container-aware resource limits
+ *
+ * Tests cgroup discovery against synthetic /proc and cgroupfs files, the
+ * quota arithmetic, and the CPU and memory budgets of the running process.
+ */
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "trlc/platform/resources.hpp"
+
+namespace trlc::platform::test {
+
+namespace fs = std::filesystem;
+
+void writeFile(const fs::path& path, const std::string& text) {
+    fs::create_directories(path.parent_path());
+    std::ofstream(path) << text;
+}
+
+void testQuotaParsing() {
+    std::cout << "Testing CPU quota parsing..." << std::endl;
+
+    assert(detail::parseCpuMax("max 100000") == 0.0);
+    assert(detail::parseCpuMax("150000 100000") == 1.5);
+    assert(detail::parseCpuMax("200000 100000\n") == 2.0);
+    assert(detail::parseCpuMax("") == 0.0);
+
+    assert(detail::listContains("rw,cpu,cpuacct", "cpu"));
+    assert(detail::listContains("cpu", "cpu"));
+    assert(!detail::listContains("rw,cpuset", "cpu"));
+
+    assert(detail::resolveCgroupPath("/sys/fs/cgroup", "/", "/") == "/sys/fs/cgroup");
+    assert(detail::resolveCgroupPath("/sys/fs/cgroup", "/", "/app") == "/sys/fs/cgroup/app");
+    assert(detail::resolveCgroupPath("/sys/fs/cgroup", "/pod", "/pod/app") ==
+           "/sys/fs/cgroup/app");
+
+    std::cout << "  ✓ CPU quotas are parsed correctly" << std::endl;
+}
+
+void testEffectiveCpus() {
+    std::cout << "Testing effective CPU computation..." << std::endl;
+
+    CpuBudget budget{16, 0, 0, 0.0, CgroupVersion::none, 0};
+    assert(detail::computeEffectiveCpus(budget) == 16);
+
+    budget.affinity_cpus = 8;
+    assert(detail::computeEffectiveCpus(budget) == 8);
+
+    budget.cpuset_cpus = 4;
+    assert(detail::computeEffectiveCpus(budget) == 4);
+
+    budget.quota_cpus = 1.5;  // Rounded up
+    assert(detail::computeEffectiveCpus(budget) == 2);
+
+    budget.quota_cpus = 0.1;
+    assert(detail::computeEffectiveCpus(budget) == 1);
+
+    CpuBudget unknown{0, 0, 0, 0.0, CgroupVersion::none, 0};
+    assert(detail::computeEffectiveCpus(unknown) == 1);
+
+    std::cout << "  ✓ Effective CPUs are the tightest limit" << std::endl;
+}
+
+void testCgroupDiscovery() {
+    std::cout << "Testing cgroup discovery..." << std::endl;
+
+    const fs::path root = fs::temp_directory_path() / "trlc_test_resources";
+    fs::remove_all(root);
+
+    // cgroup v2: quota on the parent is tighter than on the leaf
+    const std::string v2 = (root / "v2").string();
+    writeFile(root / "v2_cgroup", "0::/pod/app\n");
+    writeFile(root / "v2_mountinfo",
+              "30 25 0:26 / " + v2 + " rw,nosuid - cgroup2 cgroup2 rw,nsdelegate\n");
+    writeFile(root / "v2/pod/cpu.max", "150000 100000\n");
+    writeFile(root / "v2/pod/app/cpu.max", "max 100000\n");
+    writeFile(root / "v2/pod/app/cpuset.cpus.effective", "0-3\n");
+    writeFile(root / "v2/pod/memory.max", "1073741824\n");
+    writeFile(root / "v2/pod/app/memory.max", "max\n");
+    writeFile(root / "v2/pod/app/memory.high", "805306368\n");
+
+    const std::string v2_cgroup = (root / "v2_cgroup").string();
+    const std::string v2_mountinfo = (root / "v2_mountinfo").string();
+    detail::CgroupController cpu = detail::findCgroupController("cpu", v2_cgroup, v2_mountinfo);
+    assert(cpu.version == CgroupVersion::v2);
+    assert(cpu.path == v2 + "/pod/app");
+    assert(detail::readCgroupCpuQuota(cpu) == 1.5);
+    assert(detail::readCgroupCpusetSize(cpu) == 4);
+    assert(detail::readCgroupByteLimit(cpu, "/memory.max", 0) == 1ull << 30);
+    assert(detail::readCgroupByteLimit(cpu, "/memory.high", 0) == 768ull << 20);
+
+    // cgroup v1: separate hierarchies, unlimited quota is -1
+    const std::string v1 = (root / "v1").string();
+    writeFile(root / "v1_cgroup", "4:cpu,cpuacct:/job\n3:cpuset:/job\n0::/\n");
+    writeFile(root / "v1_mountinfo",
+              "33 32 0:29 / " + v1 + "/cpu rw - cgroup cgroup rw,cpu,cpuacct\n"
+              "35 32 0:31 / " + v1 + "/cpuset rw - cgroup cgroup rw,cpuset\n");
+    writeFile(root / "v1/cpu/job/cpu.cfs_quota_us", "250000\n");
+    writeFile(root / "v1/cpu/job/cpu.cfs_period_us", "100000\n");
+    writeFile(root / "v1/cpu/cpu.cfs_quota_us", "-1\n");
+    writeFile(root / "v1/cpu/cpu.cfs_period_us", "100000\n");
+
+    const std::string v1_cgroup = (root / "v1_cgroup").string();
+    const std::string v1_mountinfo = (root / "v1_mountinfo").string();
+    cpu = detail::findCgroupController("cpu", v1_cgroup, v1_mountinfo);
+    assert(cpu.version == CgroupVersion::v1);
+    assert(cpu.path == v1 + "/cpu/job");
+    assert(detail::readCgroupCpuQuota(cpu) == 2.5);
+
+    const detail::CgroupController cpuset =
+        detail::findCgroupController("cpuset", v1_cgroup, v1_mountinfo);
+    assert(cpuset.path == v1 + "/cpuset/job");
+    assert(detail::readCgroupCpusetSize(cpuset) == 0);  // No cpuset files
+
+    // v1 reports an unlimited memory controller as a huge number
+    writeFile(root / "v1_cgroup", "5:memory:/job\n");
+    writeFile(root / "v1_mountinfo",
+              "36 32 0:32 / " + v1 + "/memory rw - cgroup cgroup rw,memory\n");
+    writeFile(root / "v1/memory/memory.limit_in_bytes", "9223372036854771712\n");
+    writeFile(root / "v1/memory/job/memory.limit_in_bytes", "536870912\n");
+    const detail::CgroupController memory =
+        detail::findCgroupController("memory", v1_cgroup, v1_mountinfo);
+    assert(memory.version == CgroupVersion::v1);
+    const uint64_t physical = 64ull << 30;
+    assert(detail::readCgroupByteLimit(memory, "/memory.limit_in_bytes", physical) == 512ull << 20);
+    writeFile(root / "v1/memory/job/memory.limit_in_bytes", "9223372036854771712\n");
+    assert(detail::readCgroupByteLimit(memory, "/memory.limit_in_bytes", physical) == 0);
+
+    // Unknown controllers are not found
+    assert(detail::findCgroupController("rdma", v1_cgroup, v1_mountinfo).version ==
+           CgroupVersion::none);
+
+    fs::remove_all(root);
+    std::cout << "  ✓ cgroup controllers and limits are discovered correctly" << std::endl;
+}
+
+void testCpuBudget() {
+    std::cout << "Testing process CPU budget..." << std::endl;
+
+    const CpuBudget budget = getCpuBudget();
+    std::cout << "  - Online CPUs: " << budget.online_cpus << std::endl;
+    std::cout << "  - Affinity CPUs: " << budget.affinity_cpus << std::endl;
+    std::cout << "  - Cpuset CPUs: " << budget.cpuset_cpus << std::endl;
+    std::cout << "  - Quota: " << budget.quota_cpus << " CPUs (cgroup "
+              << cgroupVersionName(budget.cgroup_version) << ")" << std::endl;
+    std::cout << "  - Effective CPUs: " << budget.effective_cpus << std::endl;
+    std::cout << "  - hardware_concurrency: " << std::thread::hardware_concurrency() << std::endl;
+
+    assert(budget.effective_cpus >= 1);
+    assert(budget.effective_cpus <= budget.online_cpus || budget.online_cpus == 0);
+    if (budget.affinity_cpus != 0) {
+        assert(budget.effective_cpus <= budget.affinity_cpus);
+    }
+    if (budget.quota_cpus > 0.0) {
+        assert(budget.effective_cpus <= static_cast<size_t>(std::ceil(budget.quota_cpus)));
+    }
+
+    // Cached value and refresh agree while nothing changes
+    assert(getEffectiveCpuCount() == budget.effective_cpus);
+    assert(getEffectiveCpuCount(true) == budget.effective_cpus);
+    assert(getCpuBudget(true).effective_cpus == readCpuBudget().effective_cpus);
+
+    std::cout << "  ✓ Process CPU budget is consistent" << std::endl;
+}
+
+void testMemoryBudget() {
+    std::cout << "Testing process memory budget..." << std::endl;
+
+    const MemoryBudget budget = readMemoryBudget();
+    std::cout << "  - Physical: " << (budget.physical_bytes >> 20) << " MiB" << std::endl;
+    std::cout << "  - Limit: " << (budget.limit_bytes >> 20) << " MiB, high: "
+              << (budget.high_bytes >> 20) << " MiB (cgroup "
+              << cgroupVersionName(budget.cgroup_version) << ")" << std::endl;
+    std::cout << "  - Effective: " << (budget.effective_bytes >> 20) << " MiB" << std::endl;
+    std::cout << "  - Usage: " << (budget.usage_bytes >> 20) << " MiB" << std::endl;
+
+    if (budget.physical_bytes != 0) {
+        assert(budget.effective_bytes != 0);
+        assert(budget.effective_bytes <= budget.physical_bytes);
+    }
+    if (budget.limit_bytes != 0) {
+        assert(budget.effective_bytes <= budget.limit_bytes);
+    }
+    assert(budget.availableBytes() <= budget.effective_bytes);
+    assert(budget.isLimited() == (budget.effective_bytes < budget.physical_bytes));
+
+    assert(getEffectiveMemoryLimit() == budget.effective_bytes);
+    assert(getEffectiveMemoryLimit(true) == budget.effective_bytes);
+    assert(getMemoryBudget().effective_bytes == getEffectiveMemoryLimit());
+    assert(getMemoryBudget().limit_bytes == budget.limit_bytes);
+
+    std::cout << "  ✓ Process memory budget is consistent" << std::endl;
+}
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Resource Limit Tests ===" << std::endl;
+
+    try {
+        testQuotaParsing();
+        testEffectiveCpus();
+        testCgroupDiscovery();
+        testCpuBudget();
+        testMemoryBudget();
+
+        std::cout << "\n✅ All resource limit tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
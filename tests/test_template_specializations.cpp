@@ -43,6 +43,10 @@ void testFeatureTemplateSpecializations() {
     std::cout << "  - SSE: " << (has_sse ? "yes" : "no") << std::endl;
     std::cout << "  - AVX: " << (has_avx ? "yes" : "no") << std::endl;
     
+    // Specializations for the extended ISA features forward to the named queries
+    assert(hasRuntimeFeature<RuntimeFeature::bmi2>() == hasBmi2Support());
+    assert(hasRuntimeFeature<RuntimeFeature::avx512vl>() == hasAvx512vlSupport());
+    
     std::cout << "  ✓ Feature template specializations working" << std::endl;
 }
 
@@ -0,0 +1,298 @@
+/**
+ * @file test_topology.cpp
+ * @brief Tests for runtime CPU topology detection
+ *
+ * Tests cache hierarchy and processor topology discovery, the sysfs parsing
+ * helpers they rely on and caching of the detected results.
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "trlc/platform/affinity.hpp"
+#include "trlc/platform/topology.hpp"
+
+namespace trlc::platform::test {
+
+void testSysfsParsing() {
+    std::cout << "Testing sysfs value parsing..." << std::endl;
+
+    uint64_t value = 0;
+    assert(detail::parseUnsigned("  42\n", value) && value == 42);
+    assert(!detail::parseUnsigned("max", value));
+
+    assert(detail::parseSizeWithSuffix("48K") == 48 * 1024);
+    assert(detail::parseSizeWithSuffix("2048K") == 2048 * 1024);
+    assert(detail::parseSizeWithSuffix("32M") == 32 * 1024 * 1024);
+    assert(detail::parseSizeWithSuffix("512") == 512);
+    assert(detail::parseSizeWithSuffix("") == 0);
+
+    assert((detail::parseCpuList("0-3,8,10-11") == std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    assert((detail::parseCpuList("5") == std::vector<int>{5}));
+    assert(detail::parseCpuList("").empty());
+    assert(detail::parseCpuList("3-1").empty());
+
+    std::cout << "  ✓ sysfs values are parsed correctly" << std::endl;
+}
+
+void testCacheTopology() {
+    std::cout << "Testing cache hierarchy detection..." << std::endl;
+
+    const CacheTopology& topology = getCacheTopology();
+    assert(&topology == &getCacheTopology());  // Detected once and cached
+
+    for (const CacheInfo& cache : topology.caches) {
+        std::cout << "  - " << cacheName(cache) << ": " << cache.size_bytes / 1024 << " KiB, "
+                  << cache.line_size << " B lines, " << cache.associativity << "-way, shared by "
+                  << cache.shared_cpu_count << std::endl;
+        assert(cache.level >= 1 && cache.level <= 4);
+        assert(cache.size_bytes > 0);
+        assert(cache.line_size == 0 || (cache.line_size & (cache.line_size - 1)) == 0);
+    }
+
+    // Caches are ordered by level
+    for (size_t i = 1; i < topology.caches.size(); ++i) {
+        assert(topology.caches[i - 1].level <= topology.caches[i].level);
+    }
+
+    if (topology.isDetected()) {
+        assert(topology.l1DataSize() > 0);
+        assert(topology.lineSize() >= 16 && topology.lineSize() <= 256);
+        assert(topology.find(1, CacheType::data) != nullptr);
+        if (topology.l2Size() != 0) {
+            assert(topology.l2Size() >= topology.l1DataSize());
+        }
+    } else {
+        std::cout << "  - No cache information available on this system" << std::endl;
+    }
+
+    std::cout << "  ✓ Cache hierarchy detection works correctly" << std::endl;
+}
+
+void testCacheLookup() {
+    std::cout << "Testing cache lookup..." << std::endl;
+
+    CacheTopology topology;
+    topology.caches = {{1, CacheType::data, 32 * 1024, 64, 8, 2},
+                       {1, CacheType::instruction, 32 * 1024, 64, 8, 2},
+                       {2, CacheType::unified, 1024 * 1024, 64, 16, 2}};
+
+    assert(topology.l1DataSize() == 32 * 1024);
+    assert(topology.l2Size() == 1024 * 1024);
+    assert(topology.l3Size() == 0);
+    assert(topology.lineSize() == 64);
+
+    // Data lookups fall back to a unified cache at the same level
+    assert(topology.find(2, CacheType::data) == &topology.caches[2]);
+    assert(topology.find(3, CacheType::unified) == nullptr);
+
+    assert(cacheName(topology.caches[0]) == "L1d");
+    assert(cacheName(topology.caches[1]) == "L1i");
+    assert(cacheName(topology.caches[2]) == "L2");
+
+    std::cout << "  ✓ Cache lookup works correctly" << std::endl;
+}
+
+void testCpuTopology() {
+    std::cout << "Testing processor topology detection..." << std::endl;
+
+    const CpuTopology& topology = getCpuTopology();
+    assert(&topology == &getCpuTopology());  // Detected once and cached
+
+    std::cout << "  - " << topology.logicalCpuCount() << " logical CPUs, " << topology.core_count
+              << " cores, " << topology.package_count << " packages, " << topology.node_count
+              << " NUMA nodes" << std::endl;
+
+    assert(topology.isDetected());
+    assert(topology.core_count >= 1 && topology.core_count <= topology.logicalCpuCount());
+    assert(topology.package_count >= 1 && topology.package_count <= topology.core_count);
+    assert(topology.node_count >= 1);
+    assert(topology.firstThreadPerCore().size() == topology.core_count);
+
+    for (size_t i = 0; i < topology.cpus.size(); ++i) {
+        const LogicalCpu& cpu = topology.cpus[i];
+        if (i > 0) {
+            assert(topology.cpus[i - 1].cpu_id < cpu.cpu_id);
+        }
+        assert(topology.find(cpu.cpu_id) == &cpu);
+
+        // Every CPU is its own sibling
+        bool in_threads = false;
+        for (int sibling : cpu.thread_siblings) {
+            in_threads = in_threads || sibling == cpu.cpu_id;
+        }
+        bool in_package = false;
+        for (int sibling : cpu.package_siblings) {
+            in_package = in_package || sibling == cpu.cpu_id;
+        }
+        assert(in_threads && in_package);
+        assert(cpu.thread_siblings.size() <= cpu.package_siblings.size());
+    }
+    assert(topology.find(-1) == nullptr);
+
+    std::cout << "  - Hybrid: " << (topology.is_hybrid ? "yes" : "no") << " ("
+              << topology.cpusOfType(CoreType::performance).size() << " performance, "
+              << topology.cpusOfType(CoreType::efficiency).size() << " efficiency)" << std::endl;
+    if (topology.is_hybrid) {
+        assert(!topology.cpusOfType(CoreType::performance).empty());
+        assert(!topology.cpusOfType(CoreType::efficiency).empty());
+    } else {
+        assert(topology.cpusOfType(CoreType::efficiency).empty() ||
+               topology.cpusOfType(CoreType::performance).empty());
+    }
+
+    std::cout << "  ✓ Processor topology detection works correctly" << std::endl;
+}
+
+void testUniformCpuTopology() {
+    std::cout << "Testing synthetic processor topology..." << std::endl;
+
+    // Two packages of four cores with two threads each
+    CpuTopology topology = detail::makeUniformCpuTopology(16, 2, 8);
+    assert(topology.logicalCpuCount() == 16);
+    assert(topology.core_count == 8);
+    assert(topology.package_count == 2);
+    assert(topology.node_count == 2);
+    assert(topology.hasSmt());
+
+    const LogicalCpu* cpu = topology.find(9);
+    assert(cpu != nullptr);
+    assert(cpu->package_id == 1 && cpu->core_id == 0 && cpu->node_id == 1);
+    assert((cpu->thread_siblings == std::vector<int>{8, 9}));
+    assert(cpu->package_siblings.size() == 8);
+
+    assert((topology.firstThreadPerCore() == std::vector<int>{0, 2, 4, 6, 8, 10, 12, 14}));
+    assert((topology.cpusInPackage(0) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+    assert(topology.cpusInNode(1).size() == 8);
+    assert(topology.cpusInNode(2).empty());
+
+    // Without SMT every CPU is a core of its own
+    CpuTopology flat = detail::makeUniformCpuTopology(4, 1, 4);
+    assert(flat.core_count == 4 && flat.package_count == 1 && !flat.hasSmt());
+
+    std::cout << "  ✓ Synthetic processor topology is consistent" << std::endl;
+}
+
+void testCoreTypeClassification() {
+    std::cout << "Testing hybrid core classification..." << std::endl;
+
+    // Four big cores at capacity 1024 and four little cores at 512
+    CpuTopology topology = detail::makeUniformCpuTopology(8, 1, 8);
+    for (LogicalCpu& cpu : topology.cpus) {
+        cpu.capacity = cpu.cpu_id < 4 ? 1024 : 512;
+    }
+    assert(detail::classifyCoreTypesByCapacity(topology));
+    assert((topology.cpusOfType(CoreType::performance) == std::vector<int>{0, 1, 2, 3}));
+    assert((topology.cpusOfType(CoreType::efficiency) == std::vector<int>{4, 5, 6, 7}));
+
+    // Equal capacities mean a homogeneous processor
+    for (LogicalCpu& cpu : topology.cpus) {
+        cpu.capacity = 1024;
+    }
+    assert(detail::classifyCoreTypesByCapacity(topology));
+    assert(topology.cpusOfType(CoreType::efficiency).empty());
+
+    // Nothing is classified while any capacity is unknown
+    topology.cpus[0].capacity = 0;
+    topology.cpus[1].core_type = CoreType::unknown;
+    assert(!detail::classifyCoreTypesByCapacity(topology));
+    assert(topology.cpus[1].core_type == CoreType::unknown);
+
+    // Without any capacity the processor is treated as homogeneous
+    assert(detail::hasCapacityData(topology));
+    for (LogicalCpu& cpu : topology.cpus) {
+        cpu.capacity = 0;
+    }
+    assert(!detail::hasCapacityData(topology));
+
+    assert(std::string(coreTypeName(CoreType::efficiency)) == "efficiency");
+    assert(std::string(coreTypeName(CoreType::unknown)) == "unknown");
+
+    std::cout << "  ✓ Core types are classified correctly" << std::endl;
+}
+
+void testProbeCoreTypes() {
+    std::cout << "Testing explicit core type probing..." << std::endl;
+
+    const std::vector<int> affinity = getCurrentThreadAffinity();
+    const CpuTopology& cached = getCpuTopology();
+    const CpuTopology probed = probeCoreTypes();
+    assert(getCurrentThreadAffinity() == affinity);
+
+    assert(probed.cpus.size() == cached.cpus.size());
+    for (size_t i = 0; i < probed.cpus.size(); ++i) {
+        assert(probed.cpus[i].cpu_id == cached.cpus[i].cpu_id);
+        if (cached.cpus[i].core_type != CoreType::unknown) {
+            assert(probed.cpus[i].core_type == cached.cpus[i].core_type);
+        }
+    }
+    std::cout << "  - Unknown after probing: " << probed.cpusOfType(CoreType::unknown).size()
+              << std::endl;
+
+    std::cout << "  ✓ Probing leaves the caller's affinity alone" << std::endl;
+}
+
+#if TRLC_HAS_X86_INTRINSICS
+void testCpuidCacheLeaf() {
+    std::cout << "Testing CPUID cache parameters..." << std::endl;
+
+    std::vector<CacheInfo> caches = detail::detectCachesX86();
+    std::cout << "  - CPUID reports " << caches.size() << " caches" << std::endl;
+    for (const CacheInfo& cache : caches) {
+        assert(cache.size_bytes > 0);
+        assert(cache.line_size > 0);
+    }
+
+    std::cout << "  ✓ CPUID cache parameters are consistent" << std::endl;
+}
+
+void testCpuidTopologyLeaf() {
+    std::cout << "Testing CPUID extended topology..." << std::endl;
+
+    CpuTopology topology = detail::detectCpuTopologyX86();
+    if (topology.isDetected()) {
+        std::cout << "  - CPUID reports " << topology.logicalCpuCount() << " logical CPUs in "
+                  << topology.core_count << " cores" << std::endl;
+        assert(topology.core_count <= topology.logicalCpuCount());
+    } else {
+        std::cout << "  - CPU has no extended topology leaf" << std::endl;
+    }
+
+    std::cout << "  ✓ CPUID extended topology is consistent" << std::endl;
+}
+#endif
+
+}  // namespace trlc::platform::test
+
+int main() {
+    using namespace trlc::platform::test;
+
+    std::cout << "=== TRLC Platform Topology Tests ===" << std::endl;
+
+    try {
+        testSysfsParsing();
+        testCacheTopology();
+        testCacheLookup();
+        testCpuTopology();
+        testUniformCpuTopology();
+        testCoreTypeClassification();
+        testProbeCoreTypes();
+#if TRLC_HAS_X86_INTRINSICS
+        testCpuidCacheLeaf();
+        testCpuidTopologyLeaf();
+#endif
+
+        std::cout << "\n✅ All topology tests passed!" << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}